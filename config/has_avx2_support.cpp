@@ -0,0 +1,14 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Runs an AVX2 instruction so the check fails on machines that cannot execute the AVX2 test variants
+
+#include <immintrin.h>
+
+int main()
+{
+    volatile long long one {1};
+    const auto v {_mm256_set1_epi64x(one)};
+    return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v, v))) == 0xF ? 0 : 1;
+}
@@ -0,0 +1,14 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Runs an AVX-512F instruction so the check fails on machines that cannot execute the AVX-512 test variants
+
+#include <immintrin.h>
+
+int main()
+{
+    volatile long long one {1};
+    const auto v {_mm512_set1_epi64(one)};
+    return _mm512_cmpeq_epi64_mask(v, v) == 0xFF ? 0 : 1;
+}
@@ -0,0 +1,910 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_BATCH_HPP
+#define BOOST_INT128_BATCH_HPP
+
+#include <boost/int128/int128.hpp>
+#include <boost/int128/detail/ctz.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#endif
+
+// Vector widths used by the batch kernels, which are selected by the target flags of the translation unit
+// Each vector holds whole 128-bit elements as (low, high) pairs of 64-bit lanes
+#if (defined(__x86_64__) || defined(_M_AMD64)) && defined(__AVX512F__)
+#  define BOOST_INT128_HAS_AVX512_BATCH
+#  define BOOST_INT128_HAS_SIMD_BATCH
+#elif (defined(__x86_64__) || defined(_M_AMD64)) && defined(__AVX2__)
+#  define BOOST_INT128_HAS_AVX2_BATCH
+#  define BOOST_INT128_HAS_SIMD_BATCH
+#elif (defined(__x86_64__) && defined(__SSE2__)) || defined(_M_AMD64)
+#  define BOOST_INT128_HAS_SSE2_BATCH
+#endif
+
+namespace boost {
+namespace int128 {
+
+namespace detail {
+
+// The filters which produce bitmasks, where between includes both bounds
+enum class comparison
+{
+    equal,
+    greater,
+    between
+};
+
+#if defined(BOOST_INT128_HAS_AVX512_BATCH)
+
+using simd_vector = __m512i;
+
+BOOST_INT128_INLINE_CONSTEXPR std::size_t simd_elements {4U};
+
+BOOST_INT128_FORCE_INLINE simd_vector simd_load(const void* ptr) noexcept
+{
+    return _mm512_loadu_si512(ptr);
+}
+
+BOOST_INT128_FORCE_INLINE void simd_store(void* ptr, const simd_vector v) noexcept
+{
+    _mm512_storeu_si512(ptr, v);
+}
+
+BOOST_INT128_FORCE_INLINE simd_vector simd_broadcast(const std::int64_t high, const std::int64_t low) noexcept
+{
+    return _mm512_set_epi64(high, low, high, low, high, low, high, low);
+}
+
+// The carry (or borrow) out of each low lane is moved up into the high lane of the same element
+BOOST_INT128_FORCE_INLINE simd_vector simd_add(const simd_vector lhs, const simd_vector rhs) noexcept
+{
+    const auto sum {_mm512_add_epi64(lhs, rhs)};
+    const auto carry {static_cast<__mmask8>((_mm512_cmplt_epu64_mask(sum, lhs) << 1U) & 0xAAU)};
+    return _mm512_mask_add_epi64(sum, carry, sum, _mm512_set1_epi64(1));
+}
+
+BOOST_INT128_FORCE_INLINE simd_vector simd_sub(const simd_vector lhs, const simd_vector rhs) noexcept
+{
+    const auto difference {_mm512_sub_epi64(lhs, rhs)};
+    const auto borrow {static_cast<__mmask8>((_mm512_cmplt_epu64_mask(lhs, rhs) << 1U) & 0xAAU)};
+    return _mm512_mask_sub_epi64(difference, borrow, difference, _mm512_set1_epi64(1));
+}
+
+// Split layout, where one vector holds the low words and another the high words of the same elements
+
+BOOST_INT128_INLINE_CONSTEXPR std::size_t simd_words {8U};
+
+struct simd_split
+{
+    simd_vector low;
+    simd_vector high;
+};
+
+BOOST_INT128_FORCE_INLINE simd_split simd_add(const simd_split& lhs, const simd_split& rhs) noexcept
+{
+    const auto low {_mm512_add_epi64(lhs.low, rhs.low)};
+    const auto high {_mm512_add_epi64(lhs.high, rhs.high)};
+    return {low, _mm512_mask_add_epi64(high, _mm512_cmplt_epu64_mask(low, lhs.low), high, _mm512_set1_epi64(1))};
+}
+
+BOOST_INT128_FORCE_INLINE simd_split simd_sub(const simd_split& lhs, const simd_split& rhs) noexcept
+{
+    const auto high {_mm512_sub_epi64(lhs.high, rhs.high)};
+    return {_mm512_sub_epi64(lhs.low, rhs.low), _mm512_mask_sub_epi64(high, _mm512_cmplt_epu64_mask(lhs.low, rhs.low), high, _mm512_set1_epi64(1))};
+}
+
+BOOST_INT128_FORCE_INLINE simd_vector simd_zero() noexcept
+{
+    return _mm512_setzero_si512();
+}
+
+// Splits two vectors of consecutive elements into vectors of their low and high words, keeping the elements in order
+BOOST_INT128_FORCE_INLINE simd_split simd_deinterleave(const simd_vector first, const simd_vector second) noexcept
+{
+    const auto low_words {_mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0)};
+    const auto high_words {_mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1)};
+    return {_mm512_permutex2var_epi64(first, low_words, second), _mm512_permutex2var_epi64(first, high_words, second)};
+}
+
+// Adds v to the running sum in each lane, counting the carries out of each lane
+BOOST_INT128_FORCE_INLINE void simd_add_words(simd_vector& sums, simd_vector& carries, const simd_vector v) noexcept
+{
+    sums = _mm512_add_epi64(sums, v);
+    carries = _mm512_mask_add_epi64(carries, _mm512_cmplt_epu64_mask(sums, v), carries, _mm512_set1_epi64(1));
+}
+
+// Subtracts one from the count of each lane where v is negative, which sign extends it into the carries
+BOOST_INT128_FORCE_INLINE void simd_sign_extend_words(simd_vector& carries, const simd_vector v) noexcept
+{
+    carries = _mm512_mask_sub_epi64(carries, _mm512_cmplt_epi64_mask(v, _mm512_setzero_si512()), carries, _mm512_set1_epi64(1));
+}
+
+using simd_mask = __mmask8;
+
+// Elements where lhs < rhs. The high words decide unless they are equal, and then the low words do
+template <bool is_signed>
+BOOST_INT128_FORCE_INLINE simd_mask simd_less(const simd_split& lhs, const simd_split& rhs) noexcept
+{
+    const auto high_less {is_signed ? _mm512_cmplt_epi64_mask(lhs.high, rhs.high) : _mm512_cmplt_epu64_mask(lhs.high, rhs.high)};
+    return static_cast<simd_mask>(high_less | (_mm512_cmpeq_epi64_mask(lhs.high, rhs.high) & _mm512_cmplt_epu64_mask(lhs.low, rhs.low)));
+}
+
+BOOST_INT128_FORCE_INLINE simd_mask simd_equal(const simd_split& lhs, const simd_split& rhs) noexcept
+{
+    return static_cast<simd_mask>(_mm512_cmpeq_epi64_mask(lhs.low, rhs.low) & _mm512_cmpeq_epi64_mask(lhs.high, rhs.high));
+}
+
+// One bit per element, in order
+BOOST_INT128_FORCE_INLINE unsigned simd_mask_bits(const simd_mask mask) noexcept
+{
+    return static_cast<unsigned>(mask);
+}
+
+// Takes the elements of rhs where mask is set and those of lhs elsewhere
+BOOST_INT128_FORCE_INLINE simd_split simd_select(const simd_mask mask, const simd_split& lhs, const simd_split& rhs) noexcept
+{
+    return {_mm512_mask_blend_epi64(mask, lhs.low, rhs.low), _mm512_mask_blend_epi64(mask, lhs.high, rhs.high)};
+}
+
+#elif defined(BOOST_INT128_HAS_AVX2_BATCH)
+
+using simd_vector = __m256i;
+
+BOOST_INT128_INLINE_CONSTEXPR std::size_t simd_elements {2U};
+
+BOOST_INT128_FORCE_INLINE simd_vector simd_load(const void* ptr) noexcept
+{
+    return _mm256_loadu_si256(static_cast<const __m256i*>(ptr));
+}
+
+BOOST_INT128_FORCE_INLINE void simd_store(void* ptr, const simd_vector v) noexcept
+{
+    _mm256_storeu_si256(static_cast<__m256i*>(ptr), v);
+}
+
+BOOST_INT128_FORCE_INLINE simd_vector simd_broadcast(const std::int64_t high, const std::int64_t low) noexcept
+{
+    return _mm256_set_epi64x(high, low, high, low);
+}
+
+// AVX2 only has a signed 64-bit comparison, so both sides are offset by 2^63 to compare them as unsigned
+// The all ones compare mask of each low lane is shifted up into the high lane, where subtracting it adds the carry
+BOOST_INT128_FORCE_INLINE simd_vector simd_add(const simd_vector lhs, const simd_vector rhs) noexcept
+{
+    const auto bias {_mm256_set1_epi64x(INT64_MIN)};
+    const auto sum {_mm256_add_epi64(lhs, rhs)};
+    const auto carry {_mm256_cmpgt_epi64(_mm256_xor_si256(lhs, bias), _mm256_xor_si256(sum, bias))};
+    return _mm256_sub_epi64(sum, _mm256_slli_si256(carry, 8));
+}
+
+BOOST_INT128_FORCE_INLINE simd_vector simd_sub(const simd_vector lhs, const simd_vector rhs) noexcept
+{
+    const auto bias {_mm256_set1_epi64x(INT64_MIN)};
+    const auto difference {_mm256_sub_epi64(lhs, rhs)};
+    const auto borrow {_mm256_cmpgt_epi64(_mm256_xor_si256(rhs, bias), _mm256_xor_si256(lhs, bias))};
+    return _mm256_add_epi64(difference, _mm256_slli_si256(borrow, 8));
+}
+
+// Split layout, where one vector holds the low words and another the high words of the same elements
+// No shift is needed, as the compare mask of each low word already lines up with its high word
+
+BOOST_INT128_INLINE_CONSTEXPR std::size_t simd_words {4U};
+
+struct simd_split
+{
+    simd_vector low;
+    simd_vector high;
+};
+
+BOOST_INT128_FORCE_INLINE simd_split simd_add(const simd_split& lhs, const simd_split& rhs) noexcept
+{
+    const auto bias {_mm256_set1_epi64x(INT64_MIN)};
+    const auto low {_mm256_add_epi64(lhs.low, rhs.low)};
+    const auto carry {_mm256_cmpgt_epi64(_mm256_xor_si256(lhs.low, bias), _mm256_xor_si256(low, bias))};
+    return {low, _mm256_sub_epi64(_mm256_add_epi64(lhs.high, rhs.high), carry)};
+}
+
+BOOST_INT128_FORCE_INLINE simd_split simd_sub(const simd_split& lhs, const simd_split& rhs) noexcept
+{
+    const auto bias {_mm256_set1_epi64x(INT64_MIN)};
+    const auto borrow {_mm256_cmpgt_epi64(_mm256_xor_si256(rhs.low, bias), _mm256_xor_si256(lhs.low, bias))};
+    return {_mm256_sub_epi64(lhs.low, rhs.low), _mm256_add_epi64(_mm256_sub_epi64(lhs.high, rhs.high), borrow)};
+}
+
+BOOST_INT128_FORCE_INLINE simd_vector simd_zero() noexcept
+{
+    return _mm256_setzero_si256();
+}
+
+// Splits two vectors of consecutive elements into vectors of their low and high words, keeping the elements in order
+BOOST_INT128_FORCE_INLINE simd_split simd_deinterleave(const simd_vector first, const simd_vector second) noexcept
+{
+    // Unpacking works within each 128-bit half, giving the order 0, 2, 1, 3
+    constexpr int order {_MM_SHUFFLE(3, 1, 2, 0)};
+    return {_mm256_permute4x64_epi64(_mm256_unpacklo_epi64(first, second), order),
+            _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(first, second), order)};
+}
+
+// Adds v to the running sum in each lane, counting the carries out of each lane
+BOOST_INT128_FORCE_INLINE void simd_add_words(simd_vector& sums, simd_vector& carries, const simd_vector v) noexcept
+{
+    const auto bias {_mm256_set1_epi64x(INT64_MIN)};
+    sums = _mm256_add_epi64(sums, v);
+    carries = _mm256_sub_epi64(carries, _mm256_cmpgt_epi64(_mm256_xor_si256(v, bias), _mm256_xor_si256(sums, bias)));
+}
+
+// Subtracts one from the count of each lane where v is negative, which sign extends it into the carries
+BOOST_INT128_FORCE_INLINE void simd_sign_extend_words(simd_vector& carries, const simd_vector v) noexcept
+{
+    carries = _mm256_add_epi64(carries, _mm256_cmpgt_epi64(_mm256_setzero_si256(), v));
+}
+
+// All bits of the lanes of the selected elements are set
+using simd_mask = __m256i;
+
+// Elements where lhs < rhs. The high words decide unless they are equal, and then the low words do
+template <bool is_signed>
+BOOST_INT128_FORCE_INLINE simd_mask simd_less(const simd_split& lhs, const simd_split& rhs) noexcept
+{
+    const auto bias {_mm256_set1_epi64x(INT64_MIN)};
+    const auto low_less {_mm256_cmpgt_epi64(_mm256_xor_si256(rhs.low, bias), _mm256_xor_si256(lhs.low, bias))};
+    const auto high_less {is_signed ? _mm256_cmpgt_epi64(rhs.high, lhs.high) :
+                                      _mm256_cmpgt_epi64(_mm256_xor_si256(rhs.high, bias), _mm256_xor_si256(lhs.high, bias))};
+    return _mm256_or_si256(high_less, _mm256_and_si256(_mm256_cmpeq_epi64(lhs.high, rhs.high), low_less));
+}
+
+BOOST_INT128_FORCE_INLINE simd_mask simd_equal(const simd_split& lhs, const simd_split& rhs) noexcept
+{
+    return _mm256_and_si256(_mm256_cmpeq_epi64(lhs.low, rhs.low), _mm256_cmpeq_epi64(lhs.high, rhs.high));
+}
+
+// One bit per element, in order
+BOOST_INT128_FORCE_INLINE unsigned simd_mask_bits(const simd_mask mask) noexcept
+{
+    return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(mask)));
+}
+
+// Takes the elements of rhs where mask is set and those of lhs elsewhere
+BOOST_INT128_FORCE_INLINE simd_split simd_select(const simd_mask mask, const simd_split& lhs, const simd_split& rhs) noexcept
+{
+    return {_mm256_blendv_epi8(lhs.low, rhs.low, mask), _mm256_blendv_epi8(lhs.high, rhs.high, mask)};
+}
+
+#endif
+
+#ifdef BOOST_INT128_HAS_SIMD_BATCH
+
+// Each returns the number of leading elements processed, which is n rounded down to whole vectors
+template <bool subtract, typename T>
+inline std::size_t simd_add_sub(const T* a, const T* b, T* out, const std::size_t n) noexcept
+{
+    std::size_t i {};
+    for (; i + simd_elements <= n; i += simd_elements)
+    {
+        const auto lhs {simd_load(a + i)};
+        const auto rhs {simd_load(b + i)};
+        simd_store(out + i, subtract ? simd_sub(lhs, rhs) : simd_add(lhs, rhs));
+    }
+
+    return i;
+}
+
+template <typename T>
+inline std::size_t simd_add_scalar(const T* a, const T b, T* out, const std::size_t n) noexcept
+{
+    const auto rhs {simd_broadcast(static_cast<std::int64_t>(b.high), static_cast<std::int64_t>(b.low))};
+
+    std::size_t i {};
+    for (; i + simd_elements <= n; i += simd_elements)
+    {
+        simd_store(out + i, simd_add(simd_load(a + i), rhs));
+    }
+
+    return i;
+}
+
+// Horizontal reductions work on split words whatever the layout, since the order of the elements does not matter
+// Each lane keeps its own sum and count of carries so the loop has no cross-lane dependencies
+// With sign_extend negative high words also subtract one from their count,
+// which makes the exact sum of the elements low_lane + high_lane * 2^64 once the lanes are combined
+struct simd_sum_lanes
+{
+    simd_vector low_sums {simd_zero()};
+    simd_vector low_carries {simd_zero()};
+    simd_vector high_sums {simd_zero()};
+    simd_vector high_carries {simd_zero()};
+};
+
+template <bool sign_extend>
+BOOST_INT128_FORCE_INLINE void simd_accumulate(simd_sum_lanes& lanes, const simd_split& v) noexcept
+{
+    simd_add_words(lanes.low_sums, lanes.low_carries, v.low);
+    simd_add_words(lanes.high_sums, lanes.high_carries, v.high);
+
+    BOOST_INT128_IF_CONSTEXPR (sign_extend)
+    {
+        simd_sign_extend_words(lanes.high_carries, v.high);
+    }
+}
+
+template <typename T>
+inline void simd_combine(const simd_sum_lanes& lanes, uint128_t& low_lane, T& high_lane) noexcept
+{
+    std::uint64_t words[4U][simd_words];
+    simd_store(words[0], lanes.low_sums);
+    simd_store(words[1], lanes.low_carries);
+    simd_store(words[2], lanes.high_sums);
+    simd_store(words[3], lanes.high_carries);
+
+    using high_word_type = decltype(T{}.high);
+
+    for (std::size_t j {}; j < simd_words; ++j)
+    {
+        low_lane += uint128_t{words[1][j], words[0][j]};
+        high_lane += T{static_cast<high_word_type>(words[3][j]), words[2][j]};
+    }
+}
+
+template <bool is_max, bool is_signed>
+BOOST_INT128_FORCE_INLINE void simd_accumulate(simd_split& acc, const simd_split& v) noexcept
+{
+    acc = simd_select(is_max ? simd_less<is_signed>(acc, v) : simd_less<is_signed>(v, acc), acc, v);
+}
+
+template <bool is_max, typename T>
+inline void simd_combine(const simd_split& acc, T& result) noexcept
+{
+    using high_word_type = decltype(T{}.high);
+
+    std::uint64_t low_words[simd_words];
+    high_word_type high_words[simd_words];
+    simd_store(low_words, acc.low);
+    simd_store(high_words, acc.high);
+
+    for (std::size_t j {}; j < simd_words; ++j)
+    {
+        const T lane {high_words[j], low_words[j]};
+        if (is_max ? result < lane : lane < result)
+        {
+            result = lane;
+        }
+    }
+}
+
+// Loaders return the split words of the simd_words elements starting at i
+
+template <typename T>
+struct simd_interleaved_loader
+{
+    const T* data;
+
+    BOOST_INT128_FORCE_INLINE simd_split operator()(const std::size_t i) const noexcept
+    {
+        return simd_deinterleave(simd_load(data + i), simd_load(data + i + simd_elements));
+    }
+};
+
+template <typename HighWord>
+struct simd_split_loader
+{
+    const std::uint64_t* low;
+    const HighWord* high;
+
+    BOOST_INT128_FORCE_INLINE simd_split operator()(const std::size_t i) const noexcept
+    {
+        return {simd_load(low + i), simd_load(high + i)};
+    }
+};
+
+// Reduces the first end words of split words returned by load(i), where end is a multiple of simd_words
+// Alternating between two accumulators halves the length of the chain of dependent comparisons
+template <bool is_max, bool is_signed, typename Load>
+BOOST_INT128_FORCE_INLINE simd_split simd_min_max_blocks(simd_split acc, const std::size_t end, Load load) noexcept
+{
+    auto acc2 {acc};
+
+    std::size_t i {};
+    for (; i + simd_words < end; i += 2U * simd_words)
+    {
+        simd_accumulate<is_max, is_signed>(acc, load(i));
+        simd_accumulate<is_max, is_signed>(acc2, load(i + simd_words));
+    }
+
+    if (i < end)
+    {
+        simd_accumulate<is_max, is_signed>(acc, load(i));
+    }
+
+    simd_accumulate<is_max, is_signed>(acc, acc2);
+
+    return acc;
+}
+
+template <typename T>
+BOOST_INT128_FORCE_INLINE simd_split simd_broadcast_split(const T value) noexcept
+{
+    return {simd_broadcast(static_cast<std::int64_t>(value.low), static_cast<std::int64_t>(value.low)),
+            simd_broadcast(static_cast<std::int64_t>(value.high), static_cast<std::int64_t>(value.high))};
+}
+
+// Rounding n down before the loop lets GCC see that the scalar tail loop of the caller stays in bounds
+template <bool sign_extend, typename T>
+inline std::size_t simd_reduce_sum(const T* a, const std::size_t n, uint128_t& low_lane, T& high_lane) noexcept
+{
+    simd_sum_lanes lanes;
+
+    const auto end {n - n % simd_words};
+    for (std::size_t i {}; i < end; i += simd_words)
+    {
+        simd_accumulate<sign_extend>(lanes, simd_interleaved_loader<T>{a}(i));
+    }
+
+    simd_combine(lanes, low_lane, high_lane);
+
+    return end;
+}
+
+template <bool is_max, typename T>
+inline std::size_t simd_reduce_min_max(const T* a, const std::size_t n, T& result) noexcept
+{
+    const auto end {n - n % simd_words};
+    const auto acc {simd_min_max_blocks<is_max, std::is_same<T, int128_t>::value>(simd_broadcast_split(result), end, simd_interleaved_loader<T>{a})};
+
+    simd_combine<is_max>(acc, result);
+
+    return end;
+}
+
+// Bits of the simd_words elements of v for which the comparison holds
+template <comparison op, bool is_signed>
+BOOST_INT128_FORCE_INLINE unsigned simd_compare(const simd_split& v, const simd_split& low, const simd_split& high) noexcept
+{
+    BOOST_INT128_IF_CONSTEXPR (op == comparison::equal)
+    {
+        return simd_mask_bits(simd_equal(v, low));
+    }
+    else BOOST_INT128_IF_CONSTEXPR (op == comparison::greater)
+    {
+        return simd_mask_bits(simd_less<is_signed>(low, v));
+    }
+    else
+    {
+        const auto outside {simd_mask_bits(simd_less<is_signed>(v, low)) | simd_mask_bits(simd_less<is_signed>(high, v))};
+        return ~outside & ((1U << simd_words) - 1U);
+    }
+}
+
+// Fills whole 64-bit words of the mask, returning the number of elements processed
+template <comparison op, typename T, typename Load>
+inline std::size_t simd_compare_words(const Load load, const T low, const T high, std::uint64_t* mask, const std::size_t n) noexcept
+{
+    constexpr bool is_signed {std::is_same<T, int128_t>::value};
+
+    const auto low_split {simd_broadcast_split(low)};
+    const auto high_split {simd_broadcast_split(high)};
+
+    const auto end {n - n % 64U};
+    for (std::size_t i {}; i < end; i += 64U)
+    {
+        std::uint64_t bits {};
+        for (std::size_t j {}; j < 64U; j += simd_words)
+        {
+            bits |= static_cast<std::uint64_t>(simd_compare<op, is_signed>(load(i + j), low_split, high_split)) << j;
+        }
+
+        mask[i / 64U] = bits;
+    }
+
+    return end;
+}
+
+#endif // BOOST_INT128_HAS_SIMD_BATCH
+
+#ifdef BOOST_INT128_HAS_SSE2_BATCH
+
+BOOST_INT128_FORCE_INLINE __m128i sse2_load(const void* ptr) noexcept
+{
+    return _mm_loadu_si128(static_cast<const __m128i*>(ptr));
+}
+
+// Without AVX2 there are no 64-bit compares, so only the equality filter is vectorized,
+// comparing 32-bit halves like operator== and requiring both halves of each word to match
+// Returns one bit for each of the two elements whose low and high words are in low and high
+BOOST_INT128_FORCE_INLINE unsigned sse2_equal_pair(const __m128i low, const __m128i high, const __m128i value_low, const __m128i value_high) noexcept
+{
+    const auto equal {_mm_and_si128(_mm_cmpeq_epi32(low, value_low), _mm_cmpeq_epi32(high, value_high))};
+    const auto halves {static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(equal)))};
+    const auto words {halves & (halves >> 1U)};
+    return (words & 1U) | ((words >> 1U) & 2U);
+}
+
+template <typename T>
+struct sse2_interleaved_loader
+{
+    const T* data;
+
+    BOOST_INT128_FORCE_INLINE unsigned operator()(const std::size_t i, const __m128i value_low, const __m128i value_high) const noexcept
+    {
+        const auto first {sse2_load(data + i)};
+        const auto second {sse2_load(data + i + 1U)};
+        return sse2_equal_pair(_mm_unpacklo_epi64(first, second), _mm_unpackhi_epi64(first, second), value_low, value_high);
+    }
+};
+
+template <typename HighWord>
+struct sse2_split_loader
+{
+    const std::uint64_t* low;
+    const HighWord* high;
+
+    BOOST_INT128_FORCE_INLINE unsigned operator()(const std::size_t i, const __m128i value_low, const __m128i value_high) const noexcept
+    {
+        return sse2_equal_pair(sse2_load(low + i), sse2_load(high + i), value_low, value_high);
+    }
+};
+
+// Fills whole 64-bit words of the mask, returning the number of elements processed
+template <typename T, typename Load>
+inline std::size_t sse2_compare_eq_words(const Load load, const T value, std::uint64_t* mask, const std::size_t n) noexcept
+{
+    const auto value_low {_mm_set1_epi64x(static_cast<std::int64_t>(value.low))};
+    const auto value_high {_mm_set1_epi64x(static_cast<std::int64_t>(value.high))};
+
+    const auto end {n - n % 64U};
+    for (std::size_t i {}; i < end; i += 64U)
+    {
+        std::uint64_t bits {};
+        for (std::size_t j {}; j < 64U; j += 2U)
+        {
+            bits |= static_cast<std::uint64_t>(load(i + j, value_low, value_high)) << j;
+        }
+
+        mask[i / 64U] = bits;
+    }
+
+    return end;
+}
+
+#endif // BOOST_INT128_HAS_SSE2_BATCH
+
+template <bool subtract, typename T>
+constexpr void batch_add_sub(const T* a, const T* b, T* out, const std::size_t n) noexcept
+{
+    std::size_t i {};
+
+    #if defined(BOOST_INT128_HAS_SIMD_BATCH) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(n))
+    {
+        i = simd_add_sub<subtract>(a, b, out, n);
+    }
+
+    #endif
+
+    // Unsigned arithmetic wraps int128_t without signed overflow
+    for (; i < n; ++i)
+    {
+        const auto lhs {static_cast<uint128_t>(a[i])};
+        const auto rhs {static_cast<uint128_t>(b[i])};
+        out[i] = static_cast<T>(subtract ? lhs - rhs : lhs + rhs);
+    }
+}
+
+template <typename T>
+constexpr void batch_add_scalar(const T* a, const T b, T* out, const std::size_t n) noexcept
+{
+    std::size_t i {};
+
+    #if defined(BOOST_INT128_HAS_SIMD_BATCH) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(n))
+    {
+        i = simd_add_scalar(a, b, out, n);
+    }
+
+    #endif
+
+    const auto rhs {static_cast<uint128_t>(b)};
+    for (; i < n; ++i)
+    {
+        out[i] = static_cast<T>(static_cast<uint128_t>(a[i]) + rhs);
+    }
+}
+
+// The sum is low_lane + high_lane * 2^64, and fits when everything above the low word fits in one high word
+constexpr bool reduce_sum_finish(uint128_t* result, const uint128_t low_lane, const uint128_t high_lane) noexcept
+{
+    const auto upper {high_lane + low_lane.high};
+    *result = uint128_t{upper.low, low_lane.low};
+
+    return upper.high != 0U;
+}
+
+constexpr bool reduce_sum_finish(int128_t* result, const uint128_t low_lane, const int128_t high_lane) noexcept
+{
+    const auto upper {high_lane + static_cast<int128_t>(low_lane.high)};
+    const auto upper_word {static_cast<std::int64_t>(upper.low)};
+    *result = int128_t{upper_word, low_lane.low};
+
+    return upper != upper_word;
+}
+
+template <typename T>
+constexpr T batch_reduce_sum(const T* a, const std::size_t n) noexcept
+{
+    // Summing unsigned wraps int128_t without signed overflow
+    uint128_t sum {};
+    std::size_t i {};
+
+    #if defined(BOOST_INT128_HAS_SIMD_BATCH) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(n))
+    {
+        uint128_t low_lane {};
+        T high_lane {};
+        i = simd_reduce_sum<false>(a, n, low_lane, high_lane);
+
+        T simd_sum {};
+        reduce_sum_finish(&simd_sum, low_lane, high_lane);
+        sum = static_cast<uint128_t>(simd_sum);
+    }
+
+    #endif
+
+    for (; i < n; ++i)
+    {
+        sum += static_cast<uint128_t>(a[i]);
+    }
+
+    return static_cast<T>(sum);
+}
+
+template <typename T>
+constexpr bool batch_reduce_sum_checked(T* result, const T* a, const std::size_t n) noexcept
+{
+    uint128_t low_lane {};
+    T high_lane {};
+    std::size_t i {};
+
+    #if defined(BOOST_INT128_HAS_SIMD_BATCH) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(n))
+    {
+        i = simd_reduce_sum<std::is_same<T, int128_t>::value>(a, n, low_lane, high_lane);
+    }
+
+    #endif
+
+    for (; i < n; ++i)
+    {
+        low_lane += a[i].low;
+
+        // Widening first avoids the mixed signed operator, which branches on the sign of its operand
+        high_lane += T{a[i].high};
+    }
+
+    return reduce_sum_finish(result, low_lane, high_lane);
+}
+
+template <bool is_max, typename T>
+constexpr T batch_reduce_min_max(const T* a, const std::size_t n) noexcept
+{
+    // Starting from the identity means an empty range gives it back
+    T result {is_max ? (std::numeric_limits<T>::min)() : (std::numeric_limits<T>::max)()};
+    std::size_t i {};
+
+    #if defined(BOOST_INT128_HAS_SIMD_BATCH) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(n))
+    {
+        i = simd_reduce_min_max<is_max>(a, n, result);
+    }
+
+    #endif
+
+    for (; i < n; ++i)
+    {
+        if (is_max ? result < a[i] : a[i] < result)
+        {
+            result = a[i];
+        }
+    }
+
+    return result;
+}
+
+template <comparison op, typename T>
+constexpr bool compare_one(const T value, const T low, const T high) noexcept
+{
+    return op == comparison::equal ? value == low :
+           op == comparison::greater ? value > low :
+           !(value < low) && !(high < value);
+}
+
+template <comparison op, typename T>
+constexpr void batch_compare(const T* a, const T low, const T high, std::uint64_t* mask, const std::size_t n) noexcept
+{
+    std::size_t i {};
+
+    #if defined(BOOST_INT128_HAS_SIMD_BATCH) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(n))
+    {
+        i = simd_compare_words<op>(simd_interleaved_loader<T>{a}, low, high, mask, n);
+    }
+
+    #elif defined(BOOST_INT128_HAS_SSE2_BATCH) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    BOOST_INT128_IF_CONSTEXPR (op == comparison::equal)
+    {
+        if (!BOOST_INT128_IS_CONSTANT_EVALUATED(n))
+        {
+            i = sse2_compare_eq_words(sse2_interleaved_loader<T>{a}, low, mask, n);
+        }
+    }
+
+    #endif
+
+    for (; i < n; i += 64U)
+    {
+        const auto count {n - i < 64U ? n - i : std::size_t{64U}};
+
+        std::uint64_t bits {};
+        for (std::size_t j {}; j < count; ++j)
+        {
+            bits |= static_cast<std::uint64_t>(compare_one<op>(a[i + j], low, high)) << j;
+        }
+
+        mask[i / 64U] = bits;
+    }
+}
+
+} // namespace detail
+
+// Element-wise arithmetic over n elements, wrapping like the scalar operators
+// out may be the same array as either input, but must not otherwise overlap them
+
+BOOST_INT128_EXPORT constexpr void add(const uint128_t* a, const uint128_t* b, uint128_t* out, const std::size_t n) noexcept
+{
+    detail::batch_add_sub<false>(a, b, out, n);
+}
+
+BOOST_INT128_EXPORT constexpr void add(const int128_t* a, const int128_t* b, int128_t* out, const std::size_t n) noexcept
+{
+    detail::batch_add_sub<false>(a, b, out, n);
+}
+
+BOOST_INT128_EXPORT constexpr void sub(const uint128_t* a, const uint128_t* b, uint128_t* out, const std::size_t n) noexcept
+{
+    detail::batch_add_sub<true>(a, b, out, n);
+}
+
+BOOST_INT128_EXPORT constexpr void sub(const int128_t* a, const int128_t* b, int128_t* out, const std::size_t n) noexcept
+{
+    detail::batch_add_sub<true>(a, b, out, n);
+}
+
+BOOST_INT128_EXPORT constexpr void add_scalar(const uint128_t* a, const uint128_t b, uint128_t* out, const std::size_t n) noexcept
+{
+    detail::batch_add_scalar(a, b, out, n);
+}
+
+BOOST_INT128_EXPORT constexpr void add_scalar(const int128_t* a, const int128_t b, int128_t* out, const std::size_t n) noexcept
+{
+    detail::batch_add_scalar(a, b, out, n);
+}
+
+// Horizontal reductions over n elements
+// reduce_sum wraps like the scalar operators, while reduce_sum_checked stores the wrapped sum in *result
+// and returns true when the exact sum is not representable, like ckd_add
+// reduce_min and reduce_max of an empty range return the largest and smallest values of the type respectively
+
+BOOST_INT128_EXPORT constexpr uint128_t reduce_sum(const uint128_t* a, const std::size_t n) noexcept
+{
+    return detail::batch_reduce_sum(a, n);
+}
+
+BOOST_INT128_EXPORT constexpr int128_t reduce_sum(const int128_t* a, const std::size_t n) noexcept
+{
+    return detail::batch_reduce_sum(a, n);
+}
+
+BOOST_INT128_EXPORT constexpr bool reduce_sum_checked(uint128_t* result, const uint128_t* a, const std::size_t n) noexcept
+{
+    return detail::batch_reduce_sum_checked(result, a, n);
+}
+
+BOOST_INT128_EXPORT constexpr bool reduce_sum_checked(int128_t* result, const int128_t* a, const std::size_t n) noexcept
+{
+    return detail::batch_reduce_sum_checked(result, a, n);
+}
+
+BOOST_INT128_EXPORT constexpr uint128_t reduce_min(const uint128_t* a, const std::size_t n) noexcept
+{
+    return detail::batch_reduce_min_max<false>(a, n);
+}
+
+BOOST_INT128_EXPORT constexpr int128_t reduce_min(const int128_t* a, const std::size_t n) noexcept
+{
+    return detail::batch_reduce_min_max<false>(a, n);
+}
+
+BOOST_INT128_EXPORT constexpr uint128_t reduce_max(const uint128_t* a, const std::size_t n) noexcept
+{
+    return detail::batch_reduce_min_max<true>(a, n);
+}
+
+BOOST_INT128_EXPORT constexpr int128_t reduce_max(const int128_t* a, const std::size_t n) noexcept
+{
+    return detail::batch_reduce_min_max<true>(a, n);
+}
+
+// Filters over n elements, setting bit i % 64 of mask[i / 64] when the comparison holds for a[i]
+// mask must hold (n + 63) / 64 words, and the unused bits of the last word are cleared
+
+BOOST_INT128_EXPORT constexpr void compare_eq(const uint128_t* a, const uint128_t value, std::uint64_t* mask, const std::size_t n) noexcept
+{
+    detail::batch_compare<detail::comparison::equal>(a, value, value, mask, n);
+}
+
+BOOST_INT128_EXPORT constexpr void compare_eq(const int128_t* a, const int128_t value, std::uint64_t* mask, const std::size_t n) noexcept
+{
+    detail::batch_compare<detail::comparison::equal>(a, value, value, mask, n);
+}
+
+BOOST_INT128_EXPORT constexpr void compare_gt(const uint128_t* a, const uint128_t value, std::uint64_t* mask, const std::size_t n) noexcept
+{
+    detail::batch_compare<detail::comparison::greater>(a, value, value, mask, n);
+}
+
+BOOST_INT128_EXPORT constexpr void compare_gt(const int128_t* a, const int128_t value, std::uint64_t* mask, const std::size_t n) noexcept
+{
+    detail::batch_compare<detail::comparison::greater>(a, value, value, mask, n);
+}
+
+// low <= a[i] && a[i] <= high
+BOOST_INT128_EXPORT constexpr void compare_between(const uint128_t* a, const uint128_t low, const uint128_t high, std::uint64_t* mask, const std::size_t n) noexcept
+{
+    detail::batch_compare<detail::comparison::between>(a, low, high, mask, n);
+}
+
+BOOST_INT128_EXPORT constexpr void compare_between(const int128_t* a, const int128_t low, const int128_t high, std::uint64_t* mask, const std::size_t n) noexcept
+{
+    detail::batch_compare<detail::comparison::between>(a, low, high, mask, n);
+}
+
+// Converts a mask over n elements into a selection vector,
+// writing the indices of the set bits in increasing order and returning how many there are
+BOOST_INT128_EXPORT constexpr std::size_t select_indices(const std::uint64_t* mask, const std::size_t n, std::size_t* indices) noexcept
+{
+    std::size_t count {};
+    for (std::size_t i {}; i < n; i += 64U)
+    {
+        auto bits {mask[i / 64U]};
+        if (n - i < 64U)
+        {
+            bits &= (UINT64_C(1) << (n - i)) - 1U;
+        }
+
+        while (bits != 0U)
+        {
+            indices[count++] = i + static_cast<std::size_t>(detail::countr_zero(bits));
+            bits &= bits - 1U;
+        }
+    }
+
+    return count;
+}
+
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_BATCH_HPP
@@ -7,6 +7,7 @@
 
 #include <boost/int128/detail/config.hpp>
 #include <boost/int128/detail/clz.hpp>
+#include <boost/int128/detail/common_mul.hpp>
 
 #ifndef BOOST_INT128_BUILD_MODULE
 
@@ -265,6 +266,276 @@ BOOST_INT128_FORCE_INLINE constexpr T from_words(const std::uint32_t (&words)[4]
     return {static_cast<high_word_type>(high), low};
 }
 
+// See: Niels Möller and Torbjörn Granlund, Improved division by invariant integers,
+// IEEE Transactions on Computers 60(2), 2011, pp. 165-175
+//
+// Table of floor((2^19 - 3 * 2^8) / d9) for the 9 most significant bits of the divisor
+BOOST_INT128_INLINE_CONSTEXPR std::uint16_t reciprocal_table[256] {
+    0x7fd, 0x7f5, 0x7ed, 0x7e5, 0x7dd, 0x7d5, 0x7ce, 0x7c6,
+    0x7bf, 0x7b7, 0x7b0, 0x7a8, 0x7a1, 0x79a, 0x792, 0x78b,
+    0x784, 0x77d, 0x776, 0x76f, 0x768, 0x761, 0x75b, 0x754,
+    0x74d, 0x747, 0x740, 0x739, 0x733, 0x72c, 0x726, 0x720,
+    0x719, 0x713, 0x70d, 0x707, 0x700, 0x6fa, 0x6f4, 0x6ee,
+    0x6e8, 0x6e2, 0x6dc, 0x6d6, 0x6d1, 0x6cb, 0x6c5, 0x6bf,
+    0x6ba, 0x6b4, 0x6ae, 0x6a9, 0x6a3, 0x69e, 0x698, 0x693,
+    0x68d, 0x688, 0x683, 0x67d, 0x678, 0x673, 0x66e, 0x669,
+    0x664, 0x65e, 0x659, 0x654, 0x64f, 0x64a, 0x645, 0x640,
+    0x63c, 0x637, 0x632, 0x62d, 0x628, 0x624, 0x61f, 0x61a,
+    0x616, 0x611, 0x60c, 0x608, 0x603, 0x5ff, 0x5fa, 0x5f6,
+    0x5f1, 0x5ed, 0x5e9, 0x5e4, 0x5e0, 0x5dc, 0x5d7, 0x5d3,
+    0x5cf, 0x5cb, 0x5c6, 0x5c2, 0x5be, 0x5ba, 0x5b6, 0x5b2,
+    0x5ae, 0x5aa, 0x5a6, 0x5a2, 0x59e, 0x59a, 0x596, 0x592,
+    0x58e, 0x58a, 0x586, 0x583, 0x57f, 0x57b, 0x577, 0x574,
+    0x570, 0x56c, 0x568, 0x565, 0x561, 0x55e, 0x55a, 0x556,
+    0x553, 0x54f, 0x54c, 0x548, 0x545, 0x541, 0x53e, 0x53a,
+    0x537, 0x534, 0x530, 0x52d, 0x52a, 0x526, 0x523, 0x520,
+    0x51c, 0x519, 0x516, 0x513, 0x50f, 0x50c, 0x509, 0x506,
+    0x503, 0x500, 0x4fc, 0x4f9, 0x4f6, 0x4f3, 0x4f0, 0x4ed,
+    0x4ea, 0x4e7, 0x4e4, 0x4e1, 0x4de, 0x4db, 0x4d8, 0x4d5,
+    0x4d2, 0x4cf, 0x4cc, 0x4ca, 0x4c7, 0x4c4, 0x4c1, 0x4be,
+    0x4bb, 0x4b9, 0x4b6, 0x4b3, 0x4b0, 0x4ad, 0x4ab, 0x4a8,
+    0x4a5, 0x4a3, 0x4a0, 0x49d, 0x49b, 0x498, 0x495, 0x493,
+    0x490, 0x48d, 0x48b, 0x488, 0x486, 0x483, 0x481, 0x47e,
+    0x47c, 0x479, 0x477, 0x474, 0x472, 0x46f, 0x46d, 0x46a,
+    0x468, 0x465, 0x463, 0x461, 0x45e, 0x45c, 0x459, 0x457,
+    0x455, 0x452, 0x450, 0x44e, 0x44b, 0x449, 0x447, 0x444,
+    0x442, 0x440, 0x43e, 0x43b, 0x439, 0x437, 0x435, 0x432,
+    0x430, 0x42e, 0x42c, 0x42a, 0x428, 0x425, 0x423, 0x421,
+    0x41f, 0x41d, 0x41b, 0x419, 0x417, 0x414, 0x412, 0x410,
+    0x40e, 0x40c, 0x40a, 0x408, 0x406, 0x404, 0x402, 0x400
+};
+
+// Algorithm 3: Computes floor((2^128 - 1) / d) - 2^64 for a normalized divisor (the high bit is set)
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t reciprocal_word(const std::uint64_t d) noexcept
+{
+    BOOST_INT128_ASSUME((d >> 63U) == 1U); // LCOV_EXCL_LINE
+
+    const auto d0 {d & 1U};
+    const auto d9 {d >> 55U};
+    const auto d40 {(d >> 24U) + 1U};
+    const auto d63 {(d >> 1U) + d0};
+
+    // Newton iterations from an 11-bit table estimate
+    const auto v0 {static_cast<std::uint64_t>(reciprocal_table[d9 - 256U])};
+    const auto v1 {(v0 << 11U) - ((v0 * v0 * d40) >> 40U) - 1U};
+    const auto v2 {(v1 << 13U) + ((v1 * ((UINT64_C(1) << 60U) - v1 * d40)) >> 47U)};
+
+    const auto e {((v2 >> 1U) & (UINT64_C(0) - d0)) - v2 * d63};
+    std::uint64_t e_high {};
+    static_cast<void>(mul_64x64(v2, e, e_high));
+    const auto v3 {(v2 << 31U) + (e_high >> 1U)};
+
+    // Final adjustment: v3 - floor((2^64 + v3 + 1) * d / 2^64)
+    std::uint64_t p_high {};
+    auto p_low {mul_64x64(v3, d, p_high)};
+    p_low += d;
+    p_high += static_cast<std::uint64_t>(p_low < d);
+
+    return v3 - p_high - d;
+}
+
+// Algorithm 4: Divides u1:u0 by the normalized divisor d with reciprocal v, where u1 < d
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t div_2by1(const std::uint64_t u1, const std::uint64_t u0,
+                                                           const std::uint64_t d, const std::uint64_t v,
+                                                           std::uint64_t& r) noexcept
+{
+    std::uint64_t q1 {};
+    auto q0 {mul_64x64(v, u1, q1)};
+    q0 += u0;
+    q1 += u1 + 1U + static_cast<std::uint64_t>(q0 < u0);
+
+    r = u0 - q1 * d;
+
+    // The first adjustment is taken about half the time, so it is applied with a mask rather than a branch
+    const auto mask {UINT64_C(0) - static_cast<std::uint64_t>(r > q0)};
+    q1 += mask;
+    r += d & mask;
+
+    if (BOOST_INT128_UNLIKELY(r >= d))
+    {
+        ++q1;   // LCOV_EXCL_LINE
+        r -= d; // LCOV_EXCL_LINE
+    }
+
+    return q1;
+}
+
+// 128 / 64-bit division using two 2-by-1 steps with a single reciprocal
+// The remainder is a by-product, so callers which only need the quotient lose nothing by ignoring it
+template <typename T>
+BOOST_INT128_FORCE_INLINE constexpr T reciprocal_div(const T& lhs, const std::uint64_t rhs, std::uint64_t& remainder) noexcept
+{
+    using high_word_type = decltype(T{}.high);
+
+    const auto s {countl_zero(rhs)};
+    const auto d {rhs << s};
+    const auto v {reciprocal_word(d)};
+
+    // Normalize the numerator into 3 words to match the divisor
+    const auto high {static_cast<std::uint64_t>(lhs.high)};
+    const auto n2 {s == 0 ? UINT64_C(0) : high >> (64 - s)};
+    const auto n1 {s == 0 ? high : (high << s) | (lhs.low >> (64 - s))};
+    const auto n0 {lhs.low << s};
+
+    T quotient {};
+    std::uint64_t r {};
+    quotient.high = static_cast<high_word_type>(div_2by1(n2, n1, d, v, r));
+    quotient.low = div_2by1(r, n0, d, v, r);
+
+    remainder = r >> s;
+
+    return quotient;
+}
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+#define BOOST_INT128_HAS_X64_DIVQ
+
+// Hardware 128 / 64-bit division, the GCC/Clang equivalent of MSVC's _udiv128
+// The caller must ensure u1 < d since otherwise the quotient overflows and the instruction faults
+BOOST_INT128_FORCE_INLINE std::uint64_t divq(const std::uint64_t u1, const std::uint64_t u0,
+                                             const std::uint64_t d, std::uint64_t& r) noexcept
+{
+    std::uint64_t q {};
+    __asm__ ("divq %[d]" : "=a"(q), "=d"(r) : [d] "rm"(d), "a"(u0), "d"(u1) : "cc");
+    return q;
+}
+
+// Both the high word division and divq leave remainders which can be chained into the next step
+template <typename T>
+BOOST_INT128_FORCE_INLINE T divq_one_word(const T& lhs, const std::uint64_t rhs, std::uint64_t& remainder) noexcept
+{
+    using high_word_type = decltype(T{}.high);
+
+    T quotient {};
+    const auto high {static_cast<std::uint64_t>(lhs.high)};
+
+    if (high < rhs)
+    {
+        quotient.low = divq(high, lhs.low, rhs, remainder);
+    }
+    else
+    {
+        quotient.high = static_cast<high_word_type>(high / rhs);
+        quotient.low = divq(high % rhs, lhs.low, rhs, remainder);
+    }
+
+    return quotient;
+}
+
+#endif
+
+// Quotient digit estimate for D3: divides u1:u0 by the normalized digit d with reciprocal v, where u1 < d
+// The reciprocal is only used when there is no hardware instruction so it is optimized away otherwise
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t estimate_digit(const std::uint64_t u1, const std::uint64_t u0,
+                                                                 const std::uint64_t d, const std::uint64_t v,
+                                                                 std::uint64_t& r) noexcept
+{
+    #ifdef BOOST_INT128_HAS_X64_DIVQ
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(u0))
+    {
+        return divq(u1, u0, d, r);
+    }
+
+    #endif
+
+    return div_2by1(u1, u0, d, v, r);
+}
+
+// D3 and D4 of Algorithm D with 64-bit digits for the normalized two digit divisor v1:v0
+// Divides u2:u1:u0 where u2:u1 < v1:v0, so the quotient is a single digit, and v is the reciprocal of v1.
+// With a two digit divisor the D3 test compares against the whole divisor, so the estimate is exact
+// after it and the add back step (D6) can never be taken
+template <bool need_remainder>
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t knuth_step_3by2(const std::uint64_t u2, const std::uint64_t u1, const std::uint64_t u0,
+                                                                  const std::uint64_t v1, const std::uint64_t v0, const std::uint64_t v,
+                                                                  std::uint64_t& r1, std::uint64_t& r0) noexcept
+{
+    // D3: Estimate the quotient digit from the leading digits
+    std::uint64_t q_hat {};
+    std::uint64_t r_hat {};
+    bool r_hat_overflow {false};
+
+    if (BOOST_INT128_UNLIKELY(u2 == v1))
+    {
+        q_hat = UINT64_MAX;
+        r_hat = u1 + v1;
+        r_hat_overflow = r_hat < v1;
+    }
+    else
+    {
+        q_hat = estimate_digit(u2, u1, v1, v, r_hat);
+    }
+
+    if (!r_hat_overflow)
+    {
+        std::uint64_t p_high {};
+        auto p_low {mul_64x64(q_hat, v0, p_high)};
+
+        while (p_high > r_hat || (p_high == r_hat && p_low > u0))
+        {
+            --q_hat;
+
+            p_high -= static_cast<std::uint64_t>(p_low < v0);
+            p_low -= v0;
+
+            r_hat += v1;
+            if (r_hat < v1)
+            {
+                break;
+            }
+        }
+    }
+
+    BOOST_INT128_IF_CONSTEXPR (need_remainder)
+    {
+        // D4: Multiply and subtract, where the result is known to fit in two digits
+        std::uint64_t t0_high {};
+        const auto t0 {mul_64x64(q_hat, v0, t0_high)};
+        const auto t1 {q_hat * v1 + t0_high};
+
+        r0 = u0 - t0;
+        r1 = u1 - t1 - static_cast<std::uint64_t>(u0 < t0);
+    }
+
+    return q_hat;
+}
+
+// Algorithm D with 64-bit digits for a two word divisor (divisor.high != 0)
+// The dividend is at most two words, so the quotient is a single digit and only one pass is needed
+template <bool need_remainder, typename T>
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t knuth_divide_2x2(const T& dividend, const T& divisor, T& remainder) noexcept
+{
+    using high_word_type = decltype(T{}.high);
+
+    // D1: Normalize so that the high bit of the divisor is set
+    const auto divisor_high {static_cast<std::uint64_t>(divisor.high)};
+    const auto dividend_high {static_cast<std::uint64_t>(dividend.high)};
+
+    const auto s {countl_zero(divisor_high)};
+    const auto v1 {s == 0 ? divisor_high : (divisor_high << s) | (divisor.low >> (64 - s))};
+    const auto v0 {divisor.low << s};
+
+    const auto u2 {s == 0 ? UINT64_C(0) : dividend_high >> (64 - s)};
+    const auto u1 {s == 0 ? dividend_high : (dividend_high << s) | (dividend.low >> (64 - s))};
+    const auto u0 {dividend.low << s};
+
+    // u2 < v1 always holds after normalization
+    std::uint64_t r1 {};
+    std::uint64_t r0 {};
+    const auto q {knuth_step_3by2<need_remainder>(u2, u1, u0, v1, v0, reciprocal_word(v1), r1, r0)};
+
+    // D8: Unnormalize the remainder
+    BOOST_INT128_IF_CONSTEXPR (need_remainder)
+    {
+        remainder.high = static_cast<high_word_type>(s == 0 ? r1 : r1 >> s);
+        remainder.low = s == 0 ? r0 : (r0 >> s) | (r1 << (64 - s));
+    }
+
+    return q;
+}
+
 #if defined(_M_AMD64) && !defined(__GNUC__) && !defined(__clang__) && _MSC_VER >= 1920
 
 template <bool needs_mod, typename T>
@@ -409,6 +680,15 @@ BOOST_INT128_FORCE_INLINE constexpr void one_word_div(const T& lhs, const std::u
         return;
     }
 
+    #elif defined(BOOST_INT128_HAS_X64_DIVQ)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+    {
+        std::uint64_t remainder {};
+        quotient = impl::divq_one_word(lhs, rhs, remainder);
+        return;
+    }
+
     #endif
 
     if (rhs <= UINT32_MAX)
@@ -417,6 +697,13 @@ BOOST_INT128_FORCE_INLINE constexpr void one_word_div(const T& lhs, const std::u
     }
     else
     {
+        #ifdef BOOST_INT128_HAS_NATIVE_MUL_64X64
+
+        std::uint64_t remainder {};
+        quotient = impl::reciprocal_div(lhs, rhs, remainder);
+
+        #else
+
         std::uint32_t u[4] {};
         std::uint32_t v[2] {};
         std::uint32_t q[4] {};
@@ -427,6 +714,8 @@ BOOST_INT128_FORCE_INLINE constexpr void one_word_div(const T& lhs, const std::u
         impl::knuth_divide<false>(u, m, v, n, q);
 
         quotient = impl::from_words<T>(q);
+
+        #endif
     }
 }
 
@@ -445,7 +734,16 @@ BOOST_INT128_FORCE_INLINE constexpr void one_word_div(const T& lhs, const std::u
         return;
     }
 
-    #else
+    #elif defined(BOOST_INT128_HAS_X64_DIVQ)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+    {
+        quotient = impl::divq_one_word(lhs, rhs, remainder.low);
+        remainder.high = 0;
+        return;
+    }
+
+    #endif
 
     if (rhs <= UINT32_MAX)
     {
@@ -453,6 +751,13 @@ BOOST_INT128_FORCE_INLINE constexpr void one_word_div(const T& lhs, const std::u
     }
     else
     {
+        #ifdef BOOST_INT128_HAS_NATIVE_MUL_64X64
+
+        quotient = impl::reciprocal_div(lhs, rhs, remainder.low);
+        remainder.high = 0;
+
+        #else
+
         std::uint32_t u[4] {};
         std::uint32_t v[2] {};
         std::uint32_t q[4] {};
@@ -464,9 +769,9 @@ BOOST_INT128_FORCE_INLINE constexpr void one_word_div(const T& lhs, const std::u
 
         quotient = impl::from_words<T>(q);
         remainder = impl::from_words<T>(u);
-    }
 
-    #endif
+        #endif
+    }
 }
 
 template <typename T>
@@ -505,6 +810,27 @@ BOOST_INT128_FORCE_INLINE constexpr T knuth_div(const T& dividend, const T& divi
 
     #endif
 
+    #if defined(BOOST_INT128_HAS_NATIVE_MUL_64X64) || defined(BOOST_INT128_HAS_X64_DIVQ)
+
+    // Single word divisors have dedicated paths
+    if (divisor.high == 0)
+    {
+        T quotient {};
+        one_word_div(dividend, divisor.low, quotient);
+        return quotient;
+    }
+
+    #endif
+
+    #ifdef BOOST_INT128_HAS_NATIVE_MUL_64X64
+
+    using high_word_type = decltype(T{}.high);
+
+    T remainder {};
+    return T{static_cast<high_word_type>(0), impl::knuth_divide_2x2<false>(dividend, divisor, remainder)};
+
+    #else
+
     std::uint32_t u[4]{};
     std::uint32_t v[4]{};
     std::uint32_t q[4]{};
@@ -516,6 +842,8 @@ BOOST_INT128_FORCE_INLINE constexpr T knuth_div(const T& dividend, const T& divi
 
     return impl::from_words<T>(q);
 
+    #endif
+
 }
 
 template <typename T>
@@ -533,9 +861,29 @@ BOOST_INT128_FORCE_INLINE constexpr T knuth_div(const T& dividend, const T& divi
         }
     }
 
+    #endif
+
+    #if defined(BOOST_INT128_HAS_NATIVE_MUL_64X64) || defined(BOOST_INT128_HAS_X64_DIVQ)
+
+    // Single word divisors have dedicated paths
+    if (divisor.high == 0)
+    {
+        T quotient {};
+        remainder = T{};
+        one_word_div(dividend, divisor.low, quotient, remainder);
+        return quotient;
+    }
 
     #endif
 
+    #ifdef BOOST_INT128_HAS_NATIVE_MUL_64X64
+
+    using high_word_type = decltype(T{}.high);
+
+    return T{static_cast<high_word_type>(0), impl::knuth_divide_2x2<true>(dividend, divisor, remainder)};
+
+    #else
+
     std::uint32_t u[4]{};
     std::uint32_t v[4]{};
     std::uint32_t q[4]{};
@@ -548,6 +896,69 @@ BOOST_INT128_FORCE_INLINE constexpr T knuth_div(const T& dividend, const T& divi
     remainder = impl::from_words<T>(u);
 
     return impl::from_words<T>(q);
+
+    #endif
+}
+
+// Divides the 256-bit value high:low by divisor with Algorithm D using 64-bit digits
+// Requires high < divisor so that the quotient fits in 128 bits
+template <typename T>
+constexpr T wide_div(const T& high, const T& low, const T& divisor, T& remainder) noexcept
+{
+    using high_word_type = decltype(T{}.high);
+
+    BOOST_INT128_ASSERT_MSG(high < divisor, "Quotient would not fit in 128 bits");
+
+    const auto u3 {static_cast<std::uint64_t>(high.high)};
+    const auto u2 {high.low};
+    const auto u1 {static_cast<std::uint64_t>(low.high)};
+    const auto u0 {low.low};
+
+    T quotient {};
+    remainder = T{};
+
+    if (divisor.high == 0)
+    {
+        // high < divisor means the dividend is only three digits and the top one is already reduced
+        const auto s {countl_zero(divisor.low)};
+        const auto d {divisor.low << s};
+        const auto v {impl::reciprocal_word(d)};
+
+        const auto n2 {s == 0 ? u2 : (u2 << s) | (u1 >> (64 - s))};
+        const auto n1 {s == 0 ? u1 : (u1 << s) | (u0 >> (64 - s))};
+        const auto n0 {u0 << s};
+
+        std::uint64_t r {};
+        quotient.high = static_cast<high_word_type>(impl::estimate_digit(n2, n1, d, v, r));
+        quotient.low = impl::estimate_digit(r, n0, d, v, r);
+        remainder.low = r >> s;
+
+        return quotient;
+    }
+
+    // D1: Normalize, which cannot carry out of the top digit since high < divisor
+    const auto divisor_high {static_cast<std::uint64_t>(divisor.high)};
+    const auto s {countl_zero(divisor_high)};
+    const auto v1 {s == 0 ? divisor_high : (divisor_high << s) | (divisor.low >> (64 - s))};
+    const auto v0 {divisor.low << s};
+    const auto v {impl::reciprocal_word(v1)};
+
+    const auto n3 {s == 0 ? u3 : (u3 << s) | (u2 >> (64 - s))};
+    const auto n2 {s == 0 ? u2 : (u2 << s) | (u1 >> (64 - s))};
+    const auto n1 {s == 0 ? u1 : (u1 << s) | (u0 >> (64 - s))};
+    const auto n0 {u0 << s};
+
+    // D2-D7: One pass per quotient digit, carrying the remainder forward
+    std::uint64_t r1 {};
+    std::uint64_t r0 {};
+    quotient.high = static_cast<high_word_type>(impl::knuth_step_3by2<true>(n3, n2, n1, v1, v0, v, r1, r0));
+    quotient.low = impl::knuth_step_3by2<true>(r1, r0, n0, v1, v0, v, r1, r0);
+
+    // D8: Unnormalize the remainder
+    remainder.high = static_cast<high_word_type>(s == 0 ? r1 : r1 >> s);
+    remainder.low = s == 0 ? r0 : (r0 >> s) | (r1 << (64 - s));
+
+    return quotient;
 }
 
 #ifdef _MSC_VER
@@ -20,14 +20,12 @@ namespace detail {
 
 // See: The Art of Computer Programming Volume 2 (Semi-numerical algorithms) section 4.3.1
 // Algorithm M: Multiplication of Non-negative integers
-template <typename ReturnType, std::size_t u_size, std::size_t v_size>
-BOOST_INT128_FORCE_INLINE constexpr ReturnType knuth_multiply(const std::uint32_t (&u)[u_size],
-                                                              const std::uint32_t (&v)[v_size]) noexcept
+// w must be zero initialized by the caller
+template <std::size_t u_size, std::size_t v_size>
+BOOST_INT128_FORCE_INLINE constexpr void knuth_multiply_words(const std::uint32_t (&u)[u_size],
+                                                              const std::uint32_t (&v)[v_size],
+                                                              std::uint32_t (&w)[u_size + v_size]) noexcept
 {
-    using high_word_type = decltype(ReturnType{}.high);
-
-    std::uint32_t w[u_size + v_size] {};
-
     // M.1
     for (std::size_t j {}; j < v_size; ++j)
     {
@@ -51,6 +49,17 @@ BOOST_INT128_FORCE_INLINE constexpr ReturnType knuth_multiply(const std::uint32_
         // M.5
         w[j + u_size] = static_cast<std::uint32_t>(t);
     }
+}
+
+// Returns the low 128 bits of the product
+template <typename ReturnType, std::size_t u_size, std::size_t v_size>
+BOOST_INT128_FORCE_INLINE constexpr ReturnType knuth_multiply(const std::uint32_t (&u)[u_size],
+                                                              const std::uint32_t (&v)[v_size]) noexcept
+{
+    using high_word_type = decltype(ReturnType{}.high);
+
+    std::uint32_t w[u_size + v_size] {};
+    knuth_multiply_words(u, v, w);
 
     const auto low {static_cast<std::uint64_t>(w[0]) | (static_cast<std::uint64_t>(w[1]) << 32)};
     const auto high {static_cast<std::uint64_t>(w[2]) | (static_cast<std::uint64_t>(w[3]) << 32)};
@@ -99,6 +108,202 @@ BOOST_INT128_FORCE_INLINE constexpr void to_words(const std::uint32_t x, std::ui
     words[0] = x;
 }
 
+// Platforms where mul_64x64 is a hardware multiply (at least outside of constant evaluation)
+#if defined(BOOST_INT128_HAS_INT128) || defined(_M_AMD64) || defined(_M_ARM64)
+#  define BOOST_INT128_HAS_NATIVE_MUL_64X64
+#endif
+
+// Full 64x64 -> 128-bit product returning the low word and writing the high word to high
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t mul_64x64(const std::uint64_t lhs, const std::uint64_t rhs, std::uint64_t& high) noexcept
+{
+    #if defined(BOOST_INT128_HAS_INT128)
+
+    const auto res {static_cast<builtin_u128>(lhs) * static_cast<builtin_u128>(rhs)};
+    high = static_cast<std::uint64_t>(res >> 64U);
+    return static_cast<std::uint64_t>(res);
+
+    #else
+
+    #  if defined(_M_AMD64) && !defined(__GNUC__) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+    {
+        return _umul128(lhs, rhs, &high);
+    }
+
+    #  elif defined(_M_ARM64) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+    {
+        high = __umulh(lhs, rhs);
+        return lhs * rhs;
+    }
+
+    #  endif
+
+    const auto lhs_low {lhs & UINT32_MAX};
+    const auto lhs_high {lhs >> 32U};
+    const auto rhs_low {rhs & UINT32_MAX};
+    const auto rhs_high {rhs >> 32U};
+
+    const auto low_low {lhs_low * rhs_low};
+    const auto low_high {lhs_low * rhs_high};
+    const auto high_low {lhs_high * rhs_low};
+    const auto high_high {lhs_high * rhs_high};
+
+    const auto middle {(low_low >> 32U) + (low_high & UINT32_MAX) + (high_low & UINT32_MAX)};
+
+    high = high_high + (low_high >> 32U) + (high_low >> 32U) + (middle >> 32U);
+    return (middle << 32U) | (low_low & UINT32_MAX);
+
+    #endif
+}
+
+// Full signed 64x64 -> 128-bit product returning the low word and writing the signed high word to high
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t imul_64x64(const std::int64_t lhs, const std::int64_t rhs, std::int64_t& high) noexcept
+{
+    #if defined(BOOST_INT128_HAS_INT128)
+
+    const auto res {static_cast<builtin_i128>(lhs) * static_cast<builtin_i128>(rhs)};
+    high = static_cast<std::int64_t>(res >> 64U);
+    return static_cast<std::uint64_t>(res);
+
+    #else
+
+    #  if defined(_M_AMD64) && !defined(__GNUC__) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+    {
+        return static_cast<std::uint64_t>(_mul128(lhs, rhs, &high));
+    }
+
+    #  endif
+
+    const auto unsigned_lhs {static_cast<std::uint64_t>(lhs)};
+    const auto unsigned_rhs {static_cast<std::uint64_t>(rhs)};
+
+    std::uint64_t unsigned_high {};
+    const auto low {mul_64x64(unsigned_lhs, unsigned_rhs, unsigned_high)};
+
+    // Correct the unsigned product for the two's complement interpretation of each operand
+    unsigned_high -= lhs < 0 ? unsigned_rhs : 0U;
+    unsigned_high -= rhs < 0 ? unsigned_lhs : 0U;
+
+    high = static_cast<std::int64_t>(unsigned_high);
+    return low;
+
+    #endif
+}
+
+// Full 128x128 -> 256-bit product of the bit patterns of lhs and rhs
+// Returns the low 128 bits and writes the high 128 bits to high
+template <typename T>
+BOOST_INT128_FORCE_INLINE constexpr T umul_wide(const T& lhs, const T& rhs, T& high) noexcept
+{
+    using high_word_type = decltype(T{}.high);
+
+    #ifdef BOOST_INT128_HAS_NATIVE_MUL_64X64
+
+    std::uint64_t low_low_high {};
+    const auto low_low_low {mul_64x64(lhs.low, rhs.low, low_low_high)};
+
+    std::uint64_t high_low_high {};
+    const auto high_low_low {mul_64x64(static_cast<std::uint64_t>(lhs.high), rhs.low, high_low_high)};
+
+    std::uint64_t low_high_high {};
+    const auto low_high_low {mul_64x64(lhs.low, static_cast<std::uint64_t>(rhs.high), low_high_high)};
+
+    std::uint64_t high_high_high {};
+    const auto high_high_low {mul_64x64(static_cast<std::uint64_t>(lhs.high), static_cast<std::uint64_t>(rhs.high), high_high_high)};
+
+    // Sum the middle column, whose carries propagate into the upper half
+    auto middle {low_low_high + high_low_low};
+    auto carry {static_cast<std::uint64_t>(middle < high_low_low)};
+    middle += low_high_low;
+    carry += static_cast<std::uint64_t>(middle < low_high_low);
+
+    auto res_low {high_high_low + high_low_high};
+    auto res_high {high_high_high + static_cast<std::uint64_t>(res_low < high_low_high)};
+    res_low += low_high_high;
+    res_high += static_cast<std::uint64_t>(res_low < low_high_high);
+    res_low += carry;
+    res_high += static_cast<std::uint64_t>(res_low < carry);
+
+    high = T{static_cast<high_word_type>(res_high), res_low};
+    return T{static_cast<high_word_type>(middle), low_low_low};
+
+    #else
+
+    std::uint32_t u[4] {};
+    std::uint32_t v[4] {};
+    std::uint32_t w[8] {};
+
+    to_words(lhs, u);
+    to_words(rhs, v);
+    knuth_multiply_words(u, v, w);
+
+    high = T{static_cast<high_word_type>(static_cast<std::uint64_t>(w[6]) | (static_cast<std::uint64_t>(w[7]) << 32)),
+             static_cast<std::uint64_t>(w[4]) | (static_cast<std::uint64_t>(w[5]) << 32)};
+
+    return T{static_cast<high_word_type>(static_cast<std::uint64_t>(w[2]) | (static_cast<std::uint64_t>(w[3]) << 32)),
+             static_cast<std::uint64_t>(w[0]) | (static_cast<std::uint64_t>(w[1]) << 32)};
+
+    #endif
+}
+
+// Full 256-bit square, which only needs three partial products since the cross terms are equal
+template <typename T>
+BOOST_INT128_FORCE_INLINE constexpr T usquare_wide(const T& x, T& high) noexcept
+{
+    #ifdef BOOST_INT128_HAS_NATIVE_MUL_64X64
+
+    using high_word_type = decltype(T{}.high);
+
+    const auto x_high {static_cast<std::uint64_t>(x.high)};
+
+    std::uint64_t low_low_high {};
+    const auto low_low_low {mul_64x64(x.low, x.low, low_low_high)};
+
+    std::uint64_t cross_high {};
+    const auto cross_low {mul_64x64(x_high, x.low, cross_high)};
+
+    std::uint64_t high_high_high {};
+    const auto high_high_low {mul_64x64(x_high, x_high, high_high_high)};
+
+    // Double the cross term into three words
+    const auto cross_top {cross_high >> 63U};
+    const auto cross_mid {(cross_high << 1U) | (cross_low >> 63U)};
+    const auto cross_bottom {cross_low << 1U};
+
+    const auto w1 {low_low_high + cross_bottom};
+    const auto carry1 {static_cast<std::uint64_t>(w1 < cross_bottom)};
+
+    auto w2 {high_high_low + cross_mid};
+    auto carry2 {static_cast<std::uint64_t>(w2 < cross_mid)};
+    w2 += carry1;
+    carry2 += static_cast<std::uint64_t>(w2 < carry1);
+
+    const auto w3 {high_high_high + cross_top + carry2};
+
+    high = T{static_cast<high_word_type>(w3), w2};
+    return T{static_cast<high_word_type>(w1), low_low_low};
+
+    #else
+
+    return umul_wide(x, x, high);
+
+    #endif
+}
+
+// Upper 128 bits of the full 128x128 -> 256-bit product
+template <typename T>
+BOOST_INT128_FORCE_INLINE constexpr T umulh(const T& lhs, const T& rhs) noexcept
+{
+    T high {};
+    static_cast<void>(umul_wide(lhs, rhs, high));
+    return high;
+}
+
 } // namespace detail
 } // namespace int128
 } // namespace boost
@@ -177,6 +177,9 @@ using builtin_u128 = std::_Unsigned128;
 #  if __has_builtin(__builtin_add_overflow) && ((defined(__clang__) && __clang_major__ >= 7) || (defined(__GNUC__) && __GNUC__ >= 10))
 #    define BOOST_INT128_HAS_BUILTIN_ADD_OVERFLOW
 #  endif
+#  if __has_builtin(__builtin_mul_overflow) && ((defined(__clang__) && __clang_major__ >= 7) || (defined(__GNUC__) && __GNUC__ >= 10))
+#    define BOOST_INT128_HAS_BUILTIN_MUL_OVERFLOW
+#  endif
 #endif
 
 #if defined(__cpp_if_constexpr) && __cpp_if_constexpr >= 201606L
@@ -14,6 +14,7 @@
 #include <cerrno>
 #include <limits>
 #include <cstddef>
+#include <cstdint>
 
 #endif
 
@@ -48,6 +49,233 @@ BOOST_INT128_FORCE_INLINE constexpr auto digit_from_char(char val) noexcept -> u
     return uchar_values[static_cast<unsigned char>(val)];
 }
 
+BOOST_INT128_INLINE_CONSTEXPR std::uint64_t word_powers_of_10[] {
+    UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000), UINT64_C(100000),
+    UINT64_C(1000000), UINT64_C(10000000), UINT64_C(100000000), UINT64_C(1000000000),
+    UINT64_C(10000000000), UINT64_C(100000000000), UINT64_C(1000000000000), UINT64_C(10000000000000),
+    UINT64_C(100000000000000), UINT64_C(1000000000000000), UINT64_C(10000000000000000),
+    UINT64_C(100000000000000000), UINT64_C(1000000000000000000), UINT64_C(10000000000000000000)
+};
+
+static_assert(sizeof(word_powers_of_10) == sizeof(std::uint64_t) * 20, "Every power of 10 which fits in a word");
+
+// Reads 8 characters as a little endian word whatever the platform, which compilers merge into a single load
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t read_8_chars(const char* p) noexcept
+{
+    return static_cast<std::uint64_t>(static_cast<unsigned char>(p[0])) |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(p[1])) << 8U |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(p[2])) << 16U |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(p[3])) << 24U |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(p[4])) << 32U |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(p[5])) << 40U |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(p[6])) << 48U |
+           static_cast<std::uint64_t>(static_cast<unsigned char>(p[7])) << 56U;
+}
+
+// A byte is a digit when neither subtracting '0' nor adding 0x46 (which carries for anything past '9') sets its high bit
+BOOST_INT128_FORCE_INLINE constexpr bool is_8_digits(const std::uint64_t word) noexcept
+{
+    return (((word + UINT64_C(0x4646464646464646)) | (word - UINT64_C(0x3030303030303030))) & UINT64_C(0x8080808080808080)) == 0U;
+}
+
+// Combines adjacent digits into pairs, then pairs into the two halves, then the halves, with three multiplications
+BOOST_INT128_FORCE_INLINE constexpr std::uint32_t parse_8_digits(std::uint64_t word) noexcept
+{
+    constexpr std::uint64_t mask {UINT64_C(0x000000FF000000FF)};
+    constexpr std::uint64_t pairs_multiplier {UINT64_C(100) + (UINT64_C(1000000) << 32U)};
+    constexpr std::uint64_t quads_multiplier {UINT64_C(1) + (UINT64_C(10000) << 32U)};
+
+    word -= UINT64_C(0x3030303030303030);
+    word = word * 10U + (word >> 8U);
+    return static_cast<std::uint32_t>(((word & mask) * pairs_multiplier + ((word >> 16U) & mask) * quads_multiplier) >> 32U);
+}
+
+// Parses at most 19 digits, which always fit in a word, eight at a time while there are enough of them
+BOOST_INT128_FORCE_INLINE constexpr const char* parse_19_digits(const char* first, const char* last, std::uint64_t& chunk) noexcept
+{
+    const auto limit {last - first < 19 ? last : first + 19};
+
+    chunk = 0U;
+    while (limit - first >= 8)
+    {
+        const auto word {read_8_chars(first)};
+        if (!is_8_digits(word))
+        {
+            break;
+        }
+
+        chunk = chunk * UINT64_C(100000000) + parse_8_digits(word);
+        first += 8;
+    }
+
+    for (; first != limit; ++first)
+    {
+        const auto digit {static_cast<unsigned>(static_cast<unsigned char>(*first)) - 48U};
+        if (digit > 9U)
+        {
+            break;
+        }
+
+        chunk = chunk * 10U + digit;
+    }
+
+    return first;
+}
+
+// Base 10 fast path: the digits are parsed into 19 digit chunks, which two multiply-adds by powers of 10 combine.
+// Without leading zeros any value has at most 39 digits, and only the 39th can overflow.
+template <typename Unsigned_Integer>
+constexpr const char* parse_base_10(const char* next, const char* last, const Unsigned_Integer max_value,
+                                    Unsigned_Integer& result, bool& overflowed) noexcept
+{
+    while (next != last && *next == '0')
+    {
+        ++next;
+    }
+
+    std::uint64_t chunk {};
+    auto end {parse_19_digits(next, last, chunk)};
+    result = Unsigned_Integer{chunk};
+
+    if (end - next < 19 || end == last)
+    {
+        return end;
+    }
+
+    next = end;
+    end = parse_19_digits(next, last, chunk);
+    result = result * word_powers_of_10[end - next] + chunk;
+
+    if (end - next < 19 || end == last)
+    {
+        return end;
+    }
+
+    const auto digit {static_cast<unsigned>(static_cast<unsigned char>(*end)) - 48U};
+    if (digit > 9U)
+    {
+        return end;
+    }
+
+    if (result > (max_value - digit) / 10U || (end + 1 != last && digit_from_char(end[1]) <= 9U))
+    {
+        overflowed = true;
+        return end;
+    }
+
+    result = result * 10U + digit;
+    return end + 1;
+}
+
+// Marks the bytes of word within [low, high] with their high bit. Every byte must be below 0x80, so that nothing carries
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t bytes_in_range(const std::uint64_t word, const std::uint64_t low, const std::uint64_t high) noexcept
+{
+    constexpr std::uint64_t ones {UINT64_C(0x0101010101010101)};
+
+    const auto at_least_low {word + ones * (0x80U - low)};
+    const auto above_high {word + ones * (0x7FU - high)};
+    return at_least_low & ~above_high & UINT64_C(0x8080808080808080);
+}
+
+// Replaces 8 characters of base 2, 8 or 16 digits with their values, or returns false if any of them is not a digit
+template <int bits_per_digit>
+BOOST_INT128_FORCE_INLINE constexpr bool digits_to_values(std::uint64_t& word) noexcept
+{
+    BOOST_INT128_IF_CONSTEXPR (bits_per_digit == 4)
+    {
+        if ((word & UINT64_C(0x8080808080808080)) != 0U)
+        {
+            return false;
+        }
+
+        // Setting bit 5 folds 'A'-'F' onto 'a'-'f', whose low nibbles are 1 to 6
+        const auto lower {word | UINT64_C(0x2020202020202020)};
+        const auto digits {bytes_in_range(word, 0x30U, 0x39U)};
+        const auto letters {bytes_in_range(lower, 0x61U, 0x66U)};
+        if ((digits | letters) != UINT64_C(0x8080808080808080))
+        {
+            return false;
+        }
+
+        word = (word & UINT64_C(0x0F0F0F0F0F0F0F0F)) + (letters >> 7U) * 9U;
+        return true;
+    }
+    else
+    {
+        constexpr std::uint64_t digit_bits {((UINT64_C(1) << bits_per_digit) - 1U) * UINT64_C(0x0101010101010101)};
+
+        if ((word & ~digit_bits) != UINT64_C(0x3030303030303030))
+        {
+            return false;
+        }
+
+        word &= digit_bits;
+        return true;
+    }
+}
+
+// Packs the 8 digit values of a word, whose first character is the most significant, into 8 * bits_per_digit bits
+// by merging neighbouring bytes, then neighbouring pairs, then the two halves
+template <int bits_per_digit>
+BOOST_INT128_FORCE_INLINE constexpr std::uint32_t pack_digits(std::uint64_t values) noexcept
+{
+    values = (values * (UINT64_C(1) << bits_per_digit) + (values >> 8U)) & UINT64_C(0x00FF00FF00FF00FF);
+    values = (values * (UINT64_C(1) << (2 * bits_per_digit)) + (values >> 16U)) & UINT64_C(0x0000FFFF0000FFFF);
+    return static_cast<std::uint32_t>(values * (UINT64_C(1) << (4 * bits_per_digit)) + (values >> 32U));
+}
+
+// Base 2, 8 and 16 fast path: the digits are shifted in rather than multiplied, 8 at a time while they cannot overflow
+template <int bits_per_digit, typename Unsigned_Integer>
+constexpr const char* parse_power_of_2(const char* next, const char* last, const Unsigned_Integer max_value,
+                                       Unsigned_Integer& result, bool& overflowed) noexcept
+{
+    constexpr std::ptrdiff_t unchecked_digits {128 / bits_per_digit};
+    constexpr unsigned radix {1U << bits_per_digit};
+
+    while (next != last && *next == '0')
+    {
+        ++next;
+    }
+
+    const auto first {next};
+    while (last - next >= 8 && next - first + 8 <= unchecked_digits)
+    {
+        auto word {read_8_chars(next)};
+        if (!digits_to_values<bits_per_digit>(word))
+        {
+            break;
+        }
+
+        result = (result << (8 * bits_per_digit)) | Unsigned_Integer{pack_digits<bits_per_digit>(word)};
+        next += 8;
+    }
+
+    for (; next != last; ++next)
+    {
+        const auto digit {static_cast<unsigned>(digit_from_char(*next))};
+        if (digit >= radix)
+        {
+            break;
+        }
+
+        if (result > ((max_value - digit) >> bits_per_digit))
+        {
+            overflowed = true;
+            return next;
+        }
+
+        result = (result << bits_per_digit) | Unsigned_Integer{digit};
+    }
+
+    // The unchecked digits fit in 128 bits, but not necessarily in a signed type
+    if (result > max_value)
+    {
+        overflowed = true;
+    }
+
+    return next;
+}
+
 template <typename Integer, typename Unsigned_Integer>
 constexpr int from_chars_integer_impl(const char* first, const char* last, Integer& value, int base) noexcept
 {
@@ -97,10 +325,6 @@ constexpr int from_chars_integer_impl(const char* first, const char* last, Integ
     }
 
 
-    overflow_value /= unsigned_base;
-    overflow_value <<= 1;
-    max_digit %= unsigned_base;
-
     // If the only character was a sign abort now
     if (next == last)
     {
@@ -109,16 +333,41 @@ constexpr int from_chars_integer_impl(const char* first, const char* last, Integ
 
     bool overflowed = false;
 
-    std::ptrdiff_t nc = last - next;
-    constexpr std::ptrdiff_t nd = std::numeric_limits<Integer>::digits10;
-
+    if (base == 10)
+    {
+        next = parse_base_10(next, last, overflow_value, result, overflowed);
+    }
+    else if (base == 16)
+    {
+        next = parse_power_of_2<4>(next, last, overflow_value, result, overflowed);
+    }
+    else if (base == 8)
+    {
+        next = parse_power_of_2<3>(next, last, overflow_value, result, overflowed);
+    }
+    else if (base == 2)
+    {
+        next = parse_power_of_2<1>(next, last, overflow_value, result, overflowed);
+    }
+    else
     {
+        overflow_value /= unsigned_base;
+        max_digit %= unsigned_base;
+
+        // Each digit adds at most this many bits, so overflow is not possible in the first nd characters
+        int bits_per_digit {1};
+        for (auto b {(base - 1) >> 1}; b > 0; b >>= 1)
+        {
+            ++bits_per_digit;
+        }
+
+        std::ptrdiff_t nc = last - next;
+        const std::ptrdiff_t nd = std::numeric_limits<Integer>::digits / bits_per_digit;
+
         std::ptrdiff_t i = 0;
 
         for( ; i < nd && i < nc; ++i )
         {
-            // overflow is not possible in the first nd characters
-
             const auto current_digit = static_cast<Unsigned_Integer>(digit_from_char(*next));
 
             if (current_digit >= unsigned_base)
@@ -12,23 +12,196 @@ namespace boost {
 namespace int128 {
 namespace detail {
 
-BOOST_INT128_INLINE_CONSTEXPR char lower_case_digit_table[] = {
-    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
-    'a', 'b', 'c', 'd', 'e', 'f'
-};
+// The two digits of every value below 100, so that base 10 output takes one division per pair of digits
+BOOST_INT128_INLINE_CONSTEXPR char digit_pair_table[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
 
-static_assert(sizeof(lower_case_digit_table) == sizeof(char) * 16, "10 numbers, and 6 letters");
+static_assert(sizeof(digit_pair_table) == sizeof(char) * 201, "100 pairs of digits and the terminator");
 
-BOOST_INT128_INLINE_CONSTEXPR char upper_case_digit_table[] = {
-    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
-    'A', 'B', 'C', 'D', 'E', 'F'
-};
+// 10^19 is the largest power of 10 in a word, and its high bit is already set as div_2by1 requires
+BOOST_INT128_INLINE_CONSTEXPR std::uint64_t ten_19 {UINT64_C(10000000000000000000)};
+BOOST_INT128_INLINE_CONSTEXPR std::uint64_t ten_19_reciprocal {UINT64_C(0xD83C94FB6D2AC34A)};
 
-static_assert(sizeof(upper_case_digit_table) == sizeof(char) * 16, "10 numbers, and 6 letters");
+constexpr char* write_digit_pair(char* last, const std::uint32_t pair) noexcept
+{
+    *--last = digit_pair_table[2U * pair + 1U];
+    *--last = digit_pair_table[2U * pair];
+    return last;
+}
+
+// Writes exactly 8 digits, with leading zeros, backwards from last
+constexpr char* write_8_digits(char* last, std::uint32_t v) noexcept
+{
+    for (int i {}; i < 4; ++i)
+    {
+        last = write_digit_pair(last, v % 100U);
+        v /= 100U;
+    }
+
+    return last;
+}
+
+// Writes exactly 19 digits, with leading zeros, as 8 + 8 + 3 digits since 32-bit divisions are cheaper
+constexpr char* write_19_digits(char* last, std::uint64_t v) noexcept
+{
+    last = write_8_digits(last, static_cast<std::uint32_t>(v % 100000000U));
+    v /= 100000000U;
+    last = write_8_digits(last, static_cast<std::uint32_t>(v % 100000000U));
+
+    const auto high {static_cast<std::uint32_t>(v / 100000000U)};
+    last = write_digit_pair(last, high % 100U);
+    *--last = static_cast<char>('0' + high / 100U);
+
+    return last;
+}
+
+// Writes the digits of v without leading zeros
+constexpr char* write_digits(char* last, std::uint64_t v) noexcept
+{
+    while (v >= 100000000U)
+    {
+        last = write_8_digits(last, static_cast<std::uint32_t>(v % 100000000U));
+        v /= 100000000U;
+    }
+
+    auto low {static_cast<std::uint32_t>(v)};
+    while (low >= 100U)
+    {
+        last = write_digit_pair(last, low % 100U);
+        low /= 100U;
+    }
+
+    if (low >= 10U)
+    {
+        last = write_digit_pair(last, low);
+    }
+    else
+    {
+        *--last = static_cast<char>('0' + low);
+    }
+
+    return last;
+}
+
+// Splits v into at most three chunks of 19 digits with two 128 / 64-bit divisions by the reciprocal of 10^19,
+// instead of dividing the whole value by 10 for every digit
+constexpr char* write_base_10(char* last, const uint128_t v) noexcept
+{
+    if (v.high == 0U)
+    {
+        return write_digits(last, v.low);
+    }
+
+    // The high word is less than 2 * 10^19 so the quotient has at most one bit in its high word
+    const auto quotient_high {static_cast<std::uint64_t>(v.high >= ten_19)};
+    std::uint64_t low_chunk {};
+    const auto quotient_low {impl::div_2by1(v.high - quotient_high * ten_19, v.low, ten_19, ten_19_reciprocal, low_chunk)};
+    last = write_19_digits(last, low_chunk);
+
+    if (quotient_high == 0U && quotient_low < ten_19)
+    {
+        return write_digits(last, quotient_low);
+    }
 
-constexpr char* mini_to_chars(char (&buffer)[64], uint128_t v, const int base, const bool uppercase) noexcept
+    std::uint64_t middle_chunk {};
+    const auto high_chunk {impl::div_2by1(quotient_high, quotient_low, ten_19, ten_19_reciprocal, middle_chunk)};
+    last = write_19_digits(last, middle_chunk);
+
+    return write_digits(last, high_chunk);
+}
+
+// Spreads the 8 nibbles of a 32-bit value into the low halves of 8 bytes, the least significant into the lowest byte
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t spread_nibbles(const std::uint32_t v) noexcept
+{
+    auto x {static_cast<std::uint64_t>(v)};
+    x = (x | (x << 16U)) & UINT64_C(0x0000FFFF0000FFFF);
+    x = (x | (x << 8U)) & UINT64_C(0x00FF00FF00FF00FF);
+    return (x | (x << 4U)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+}
+
+// Turns every byte holding 0 to 15 into its hex digit without branches, since adding 6 carries into bit 4 from 10 up
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t nibbles_to_hex(const std::uint64_t nibbles, const bool uppercase) noexcept
+{
+    const auto letters {((nibbles + UINT64_C(0x0606060606060606)) >> 4U) & UINT64_C(0x0101010101010101)};
+    return nibbles + UINT64_C(0x3030303030303030) + letters * (uppercase ? UINT64_C(7) : UINT64_C(39));
+}
+
+// Spreads the eight 3-bit groups of a 24-bit value into 8 bytes of octal digits
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t spread_octal(const std::uint32_t v) noexcept
+{
+    auto x {static_cast<std::uint64_t>(v & 0xFFFFFFU)};
+    x = (x | (x << 20U)) & UINT64_C(0x00000FFF00000FFF);
+    x = (x | (x << 10U)) & UINT64_C(0x003F003F003F003F);
+    return ((x | (x << 5U)) & UINT64_C(0x0707070707070707)) + UINT64_C(0x3030303030303030);
+}
+
+// Spreads the 8 bits of a byte into 8 bytes of binary digits, by isolating bit i in byte i and letting it carry into the high bit
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t spread_bits(const std::uint64_t byte) noexcept
+{
+    const auto bits {((byte & 0xFFU) * UINT64_C(0x0101010101010101)) & UINT64_C(0x8040201008040201)};
+    return (((bits + UINT64_C(0x7F7F7F7F7F7F7F7F)) >> 7U) & UINT64_C(0x0101010101010101)) + UINT64_C(0x3030303030303030);
+}
+
+// Writes the 8 characters of a word backwards from last, so that its lowest byte becomes the last character
+BOOST_INT128_FORCE_INLINE constexpr char* write_8_chars(char* last, std::uint64_t chars) noexcept
+{
+    for (int i {}; i < 8; ++i)
+    {
+        *--last = static_cast<char>(chars & 0xFFU);
+        chars >>= 8U;
+    }
+
+    return last;
+}
+
+// Power of 2 bases write 8 digits per step, and then drop the leading zeros of the final step
+template <int bits_per_digit>
+constexpr char* write_power_of_2(char* last, uint128_t v, const bool uppercase) noexcept
+{
+    const auto bits {v.high != 0U ? 128 - countl_zero(v.high) : 64 - countl_zero(v.low)};
+    const auto digits {(bits + bits_per_digit - 1) / bits_per_digit};
+    const auto end {last};
+
+    for (int written {}; written < digits; written += 8)
+    {
+        BOOST_INT128_IF_CONSTEXPR (bits_per_digit == 4)
+        {
+            last = write_8_chars(last, nibbles_to_hex(spread_nibbles(static_cast<std::uint32_t>(v.low)), uppercase));
+        }
+        else BOOST_INT128_IF_CONSTEXPR (bits_per_digit == 3)
+        {
+            last = write_8_chars(last, spread_octal(static_cast<std::uint32_t>(v.low)));
+        }
+        else
+        {
+            last = write_8_chars(last, spread_bits(v.low));
+        }
+
+        v >>= 8 * bits_per_digit;
+    }
+
+    return end - digits;
+}
+
+// Enough for the 128 binary digits of any value, a sign and the terminator. Other bases fit in 64 characters
+BOOST_INT128_INLINE_CONSTEXPR std::size_t mini_to_chars_binary_size {130U};
+
+template <std::size_t N>
+constexpr char* mini_to_chars(char (&buffer)[N], uint128_t v, const int base, const bool uppercase) noexcept
 {
-    char* last {buffer + 64U};
+    static_assert(N >= 64U, "The buffer must hold the digits of any value in base 8, 10 or 16");
+    BOOST_INT128_ASSERT_MSG(base != 2 || N >= mini_to_chars_binary_size, "The buffer must hold 128 binary digits");
+
+    char* last {buffer + N};
     *--last = '\0';
 
     if (v == 0U)
@@ -37,41 +210,22 @@ constexpr char* mini_to_chars(char (&buffer)[64], uint128_t v, const int base, c
         return last;
     }
 
-    const auto digit_table {uppercase ? upper_case_digit_table : lower_case_digit_table};
-
     switch (base)
     {
         case 2:
-            while (v != 0U)
-            {
-                *--last = v.low & 1U ? '1' : '0';
-                v >>= 1U;
-            }
+            last = write_power_of_2<1>(last, v, uppercase);
             break;
 
         case 8:
-            while (v != 0U)
-            {
-                constexpr unsigned zero {48U};
-                *--last = static_cast<char>(zero + (v & 7U));
-                v >>= 3U;
-            }
+            last = write_power_of_2<3>(last, v, uppercase);
             break;
 
         case 10:
-            while (v != 0U)
-            {
-                *--last = digit_table[static_cast<std::size_t>(v % 10U)];
-                v /= 10U;
-            }
+            last = write_base_10(last, v);
             break;
 
         case 16:
-            while (v != 0U)
-            {
-                *--last = digit_table[static_cast<std::size_t>(v & 15U)];
-                v >>= 4U;
-            }
+            last = write_power_of_2<4>(last, v, uppercase);
             break;
 
         default:                        // LCOV_EXCL_LINE
@@ -81,7 +235,8 @@ constexpr char* mini_to_chars(char (&buffer)[64], uint128_t v, const int base, c
     return last;
 }
 
-constexpr char* mini_to_chars(char (&buffer)[64], const int128_t v, const int base, const bool uppercase) noexcept
+template <std::size_t N>
+constexpr char* mini_to_chars(char (&buffer)[N], const int128_t v, const int base, const bool uppercase) noexcept
 {
     char* p {nullptr};
 
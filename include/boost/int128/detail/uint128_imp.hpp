@@ -2979,6 +2979,17 @@ constexpr uint128_t operator/(const uint128_t lhs, const uint128_t rhs) noexcept
     #if defined(BOOST_INT128_HAS_INT128) && !defined(__s390__) && !defined(__s390x__)
     else
     {
+        #ifdef BOOST_INT128_HAS_X64_DIVQ
+
+        // The builtin division is a call to __udivti3 even when the divisor only has one word
+        if (rhs.high == 0U && !BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+        {
+            std::uint64_t remainder {};
+            return detail::impl::divq_one_word(lhs, rhs.low, remainder);
+        }
+
+        #endif
+
         return static_cast<uint128_t>(static_cast<detail::builtin_u128>(lhs) / static_cast<detail::builtin_u128>(rhs));
     }
     #else
@@ -3190,6 +3201,18 @@ constexpr uint128_t operator%(const uint128_t lhs, const uint128_t rhs) noexcept
     #if defined(BOOST_INT128_HAS_INT128) && !defined(__s390__) && !defined(__s390x__)
     else
     {
+        #ifdef BOOST_INT128_HAS_X64_DIVQ
+
+        // The builtin remainder is a call to __umodti3 even when the divisor only has one word
+        if (rhs.high == 0U && !BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+        {
+            std::uint64_t remainder {};
+            static_cast<void>(detail::impl::divq_one_word(lhs, rhs.low, remainder));
+            return uint128_t{remainder};
+        }
+
+        #endif
+
         return static_cast<uint128_t>(static_cast<detail::builtin_u128>(lhs) % static_cast<detail::builtin_u128>(rhs));
     }
     #else
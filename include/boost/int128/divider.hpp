@@ -0,0 +1,447 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_DIVIDER_HPP
+#define BOOST_INT128_DIVIDER_HPP
+
+#include <boost/int128/int128.hpp>
+#include <boost/int128/bit.hpp>
+#include <boost/int128/cstdlib.hpp>
+#include <boost/int128/numeric.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstdint>
+#include <limits>
+
+#endif
+
+namespace boost {
+namespace int128 {
+
+namespace detail {
+
+enum class divider_algorithm : std::uint8_t
+{
+    zero,
+    shift,
+    multiply,
+    multiply_add,
+    word
+};
+
+} // namespace detail
+
+BOOST_INT128_EXPORT template <typename T>
+class divider;
+
+// Division by an invariant divisor using a precomputed multiplicative inverse
+// See: Granlund and Montgomery, Division by Invariant Integers using Multiplication (1994)
+// and the round-up method of libdivide. Without a native 64x64 multiply one word divisors instead use the
+// 2-by-1 division of Moller and Granlund, Improved division by invariant integers (2011), or divq on x64
+template <>
+class divider<uint128_t>
+{
+private:
+
+    uint128_t magic_ {};
+    uint128_t divisor_ {};
+    int shift_ {};
+    detail::divider_algorithm algorithm_ {detail::divider_algorithm::zero};
+
+    constexpr void init() noexcept;
+
+    constexpr uint128_t word_divide(uint128_t numerator, std::uint64_t& remainder) const noexcept;
+
+public:
+
+    constexpr divider() noexcept : divider(uint128_t{0U, 1U}) {}
+
+    explicit constexpr divider(const uint128_t divisor) noexcept : divisor_ {divisor} { init(); }
+
+    template <BOOST_INT128_DEFAULTED_UNSIGNED_INTEGER_CONCEPT>
+    explicit constexpr divider(const UnsignedInteger divisor) noexcept : divisor_ {divisor} { init(); }
+
+    constexpr uint128_t divisor() const noexcept { return divisor_; }
+
+    constexpr uint128_t quotient(uint128_t numerator) const noexcept;
+
+    constexpr uint128_t remainder(uint128_t numerator) const noexcept;
+
+    constexpr u128div_t divide(uint128_t numerator) const noexcept;
+};
+
+constexpr void divider<uint128_t>::init() noexcept
+{
+    if (BOOST_INT128_UNLIKELY(divisor_ == 0U))
+    {
+        algorithm_ = detail::divider_algorithm::zero;
+        return;
+    }
+
+    const auto floor_log_2_d {127 - countl_zero(divisor_)};
+
+    if (has_single_bit(divisor_))
+    {
+        shift_ = floor_log_2_d;
+        algorithm_ = detail::divider_algorithm::shift;
+        return;
+    }
+
+    #ifndef BOOST_INT128_HAS_NATIVE_MUL_64X64
+
+    // Without a native 64x64 multiply a one word divisor is cheaper to divide by one quotient word at a time,
+    // with its reciprocal taking two multiplies per word rather than the four of a full 128-bit mulhi (or divq).
+    // The magic number holds the normalized divisor in the high word and its reciprocal in the low word
+    if (divisor_.high == 0U)
+    {
+        shift_ = detail::countl_zero(divisor_.low);
+        const auto d {divisor_.low << shift_};
+        magic_ = uint128_t{d, detail::impl::reciprocal_word(d)};
+        algorithm_ = detail::divider_algorithm::word;
+        return;
+    }
+
+    #endif
+
+    // 2^(128 + floor_log_2_d) / d fits in 128 bits because d is not a power of 2
+    uint128_t rem {};
+    auto proposed_m {detail::wide_div(uint128_t{0U, 1U} << floor_log_2_d, uint128_t{0U, 0U}, divisor_, rem)};
+    const auto e {divisor_ - rem};
+
+    if (e < (uint128_t{0U, 1U} << floor_log_2_d))
+    {
+        // This power of 2 works without needing the extra bit of precision
+        algorithm_ = detail::divider_algorithm::multiply;
+    }
+    else
+    {
+        // We need a 129-bit magic number so we carry the top bit via an add and shift
+        proposed_m += proposed_m;
+        const auto twice_rem {rem + rem};
+        if (twice_rem >= divisor_ || twice_rem < rem)
+        {
+            ++proposed_m;
+        }
+
+        algorithm_ = detail::divider_algorithm::multiply_add;
+    }
+
+    magic_ = proposed_m + 1U;
+    shift_ = floor_log_2_d;
+}
+
+// Same steps as the one word divisor case of detail::wide_div, with the normalization and reciprocal computed by init
+constexpr uint128_t divider<uint128_t>::word_divide(const uint128_t numerator, std::uint64_t& remainder) const noexcept
+{
+    const auto d {magic_.high};
+    const auto n2 {(numerator.high >> 1U) >> (63 - shift_)};
+    const auto n1 {(numerator.high << shift_) | ((numerator.low >> 1U) >> (63 - shift_))};
+    const auto n0 {numerator.low << shift_};
+
+    std::uint64_t r {};
+    const auto high {detail::impl::estimate_digit(n2, n1, d, magic_.low, r)};
+    const auto low {detail::impl::estimate_digit(r, n0, d, magic_.low, r)};
+    remainder = r >> shift_;
+
+    return uint128_t{high, low};
+}
+
+constexpr uint128_t divider<uint128_t>::quotient(const uint128_t numerator) const noexcept
+{
+    switch (algorithm_)
+    {
+        case detail::divider_algorithm::shift:
+            return numerator >> shift_;
+        case detail::divider_algorithm::word:
+        {
+            std::uint64_t r {};
+            return word_divide(numerator, r);
+        }
+        case detail::divider_algorithm::multiply:
+            return mulhi(magic_, numerator) >> shift_;
+        case detail::divider_algorithm::multiply_add:
+        {
+            const auto q {mulhi(magic_, numerator)};
+            const auto t {((numerator - q) >> 1U) + q};
+            return t >> shift_;
+        }
+        default:
+            return {0U, 0U};
+    }
+}
+
+constexpr uint128_t divider<uint128_t>::remainder(const uint128_t numerator) const noexcept
+{
+    switch (algorithm_)
+    {
+        case detail::divider_algorithm::zero:
+            return {0U, 0U};
+        case detail::divider_algorithm::shift:
+            return numerator & (divisor_ - 1U);
+        case detail::divider_algorithm::word:
+        {
+            std::uint64_t r {};
+            static_cast<void>(word_divide(numerator, r));
+            return uint128_t{r};
+        }
+        default:
+            return numerator - quotient(numerator) * divisor_;
+    }
+}
+
+constexpr u128div_t divider<uint128_t>::divide(const uint128_t numerator) const noexcept
+{
+    if (BOOST_INT128_UNLIKELY(algorithm_ == detail::divider_algorithm::zero))
+    {
+        return u128div_t{0U, 0U};
+    }
+
+    if (algorithm_ == detail::divider_algorithm::word)
+    {
+        std::uint64_t r {};
+        const auto q {word_divide(numerator, r)};
+        return u128div_t{q, uint128_t{r}};
+    }
+
+    const auto q {quotient(numerator)};
+    return u128div_t{q, numerator - q * divisor_};
+}
+
+// The signed divider reproduces the truncating semantics of int128_t::operator/ and operator%,
+// and additionally offers floored and Euclidean division
+template <>
+class divider<int128_t>
+{
+private:
+
+    int128_t magic_ {};
+    int128_t divisor_ {};
+    int shift_ {};
+    detail::divider_algorithm algorithm_ {detail::divider_algorithm::zero};
+
+    constexpr void init() noexcept;
+
+public:
+
+    constexpr divider() noexcept : divider(int128_t{0, 1U}) {}
+
+    explicit constexpr divider(const int128_t divisor) noexcept : divisor_ {divisor} { init(); }
+
+    template <BOOST_INT128_DEFAULTED_SIGNED_INTEGER_CONCEPT>
+    explicit constexpr divider(const SignedInteger divisor) noexcept : divisor_ {divisor} { init(); }
+
+    constexpr int128_t divisor() const noexcept { return divisor_; }
+
+    // Rounds towards zero
+    constexpr int128_t quotient(int128_t numerator) const noexcept;
+
+    // Has the same sign as the numerator
+    constexpr int128_t remainder(int128_t numerator) const noexcept;
+
+    constexpr i128div_t divide(int128_t numerator) const noexcept;
+
+    // Rounds towards negative infinity so the remainder has the same sign as the divisor
+    constexpr i128div_t floor_divide(int128_t numerator) const noexcept;
+
+    // The remainder is always non-negative
+    constexpr i128div_t euclid_divide(int128_t numerator) const noexcept;
+};
+
+constexpr void divider<int128_t>::init() noexcept
+{
+    if (BOOST_INT128_UNLIKELY(divisor_ == 0))
+    {
+        algorithm_ = detail::divider_algorithm::zero;
+        return;
+    }
+
+    const auto is_neg {divisor_ < 0};
+    const auto unsigned_divisor {static_cast<uint128_t>(divisor_)};
+    const auto abs_divisor {is_neg ? -unsigned_divisor : unsigned_divisor};
+    const auto floor_log_2_d {127 - countl_zero(abs_divisor)};
+
+    if (has_single_bit(abs_divisor))
+    {
+        shift_ = floor_log_2_d;
+        algorithm_ = detail::divider_algorithm::shift;
+        return;
+    }
+
+    // 2^(127 + floor_log_2_d) / |d| fits in 128 bits because |d| is not a power of 2
+    uint128_t rem {};
+    auto proposed_m {detail::wide_div(uint128_t{0U, 1U} << (floor_log_2_d - 1), uint128_t{0U, 0U}, abs_divisor, rem)};
+    const auto e {abs_divisor - rem};
+
+    if (e < (uint128_t{0U, 1U} << floor_log_2_d))
+    {
+        // This power of 2 works without needing the extra bit of precision
+        algorithm_ = detail::divider_algorithm::multiply;
+        shift_ = floor_log_2_d - 1;
+    }
+    else
+    {
+        // Go one power higher, which makes the magic number negative when interpreted as signed,
+        // so the numerator has to be added back after the multiplication
+        proposed_m += proposed_m;
+        const auto twice_rem {rem + rem};
+        if (twice_rem >= abs_divisor || twice_rem < rem)
+        {
+            ++proposed_m;
+        }
+
+        algorithm_ = detail::divider_algorithm::multiply_add;
+        shift_ = floor_log_2_d;
+    }
+
+    ++proposed_m;
+    magic_ = static_cast<int128_t>(is_neg ? -proposed_m : proposed_m);
+}
+
+constexpr int128_t divider<int128_t>::quotient(const int128_t numerator) const noexcept
+{
+    // All intermediate arithmetic is done unsigned so that INT128_MIN / -1 wraps rather than overflows
+    // The signs are applied through masks, so numerators of mixed signs cost no mispredicted branches
+    const auto unsigned_numerator {static_cast<uint128_t>(numerator)};
+    const auto numerator_sign {detail::sign_mask(numerator)};
+    const auto divisor_sign {detail::sign_mask(divisor_)};
+
+    switch (algorithm_)
+    {
+        case detail::divider_algorithm::shift:
+        {
+            // Bias negative numerators so that the arithmetic shift rounds towards zero
+            const auto bias {((uint128_t{0U, 1U} << shift_) - 1U) & numerator_sign};
+            const auto q {static_cast<uint128_t>(static_cast<int128_t>(unsigned_numerator + bias) >> shift_)};
+            return static_cast<int128_t>((q ^ divisor_sign) - divisor_sign);
+        }
+        case detail::divider_algorithm::multiply:
+        case detail::divider_algorithm::multiply_add:
+        {
+            // The signed high product subtracts the numerator when the magic number is negative,
+            // and multiply_add adds the numerator back, negated for a negative divisor.
+            // The magic number is negative exactly for multiply_add with a positive divisor and multiply with a negative one,
+            // so together the two leave the numerator subtracted only when the divisor is negative
+            const auto unsigned_magic {static_cast<uint128_t>(magic_)};
+            const auto uq {detail::umulh(unsigned_magic, unsigned_numerator) - (unsigned_magic & numerator_sign) - (unsigned_numerator & divisor_sign)};
+
+            // Round towards zero rather than negative infinity by adding back the sign bit
+            const auto q {static_cast<uint128_t>(static_cast<int128_t>(uq) >> shift_)};
+            return static_cast<int128_t>(q + (q.high >> 63U));
+        }
+        default:
+            return {0, 0};
+    }
+}
+
+constexpr int128_t divider<int128_t>::remainder(const int128_t numerator) const noexcept
+{
+    return divide(numerator).rem;
+}
+
+constexpr i128div_t divider<int128_t>::divide(const int128_t numerator) const noexcept
+{
+    if (BOOST_INT128_UNLIKELY(algorithm_ == detail::divider_algorithm::zero))
+    {
+        return i128div_t{0, 0};
+    }
+
+    const auto q {quotient(numerator)};
+    const auto r {static_cast<uint128_t>(numerator) - static_cast<uint128_t>(q) * static_cast<uint128_t>(divisor_)};
+
+    return i128div_t{q, static_cast<int128_t>(r)};
+}
+
+constexpr i128div_t divider<int128_t>::floor_divide(const int128_t numerator) const noexcept
+{
+    auto res {divide(numerator)};
+
+    if (res.rem != 0 && ((res.rem < 0) != (divisor_ < 0)))
+    {
+        --res.quot;
+        res.rem += divisor_;
+    }
+
+    return res;
+}
+
+constexpr i128div_t divider<int128_t>::euclid_divide(const int128_t numerator) const noexcept
+{
+    auto res {divide(numerator)};
+
+    if (res.rem < 0)
+    {
+        if (divisor_ < 0)
+        {
+            ++res.quot;
+            res.rem -= divisor_;
+        }
+        else
+        {
+            --res.quot;
+            res.rem += divisor_;
+        }
+    }
+
+    return res;
+}
+
+BOOST_INT128_EXPORT constexpr uint128_t operator/(const uint128_t lhs, const divider<uint128_t>& rhs) noexcept
+{
+    return rhs.quotient(lhs);
+}
+
+BOOST_INT128_EXPORT constexpr uint128_t operator%(const uint128_t lhs, const divider<uint128_t>& rhs) noexcept
+{
+    return rhs.remainder(lhs);
+}
+
+BOOST_INT128_EXPORT constexpr uint128_t& operator/=(uint128_t& lhs, const divider<uint128_t>& rhs) noexcept
+{
+    lhs = rhs.quotient(lhs);
+    return lhs;
+}
+
+BOOST_INT128_EXPORT constexpr uint128_t& operator%=(uint128_t& lhs, const divider<uint128_t>& rhs) noexcept
+{
+    lhs = rhs.remainder(lhs);
+    return lhs;
+}
+
+BOOST_INT128_EXPORT constexpr u128div_t div(const uint128_t lhs, const divider<uint128_t>& rhs) noexcept
+{
+    return rhs.divide(lhs);
+}
+
+BOOST_INT128_EXPORT constexpr int128_t operator/(const int128_t lhs, const divider<int128_t>& rhs) noexcept
+{
+    return rhs.quotient(lhs);
+}
+
+BOOST_INT128_EXPORT constexpr int128_t operator%(const int128_t lhs, const divider<int128_t>& rhs) noexcept
+{
+    return rhs.remainder(lhs);
+}
+
+BOOST_INT128_EXPORT constexpr int128_t& operator/=(int128_t& lhs, const divider<int128_t>& rhs) noexcept
+{
+    lhs = rhs.quotient(lhs);
+    return lhs;
+}
+
+BOOST_INT128_EXPORT constexpr int128_t& operator%=(int128_t& lhs, const divider<int128_t>& rhs) noexcept
+{
+    lhs = rhs.remainder(lhs);
+    return lhs;
+}
+
+BOOST_INT128_EXPORT constexpr i128div_t div(const int128_t lhs, const divider<int128_t>& rhs) noexcept
+{
+    return rhs.divide(lhs);
+}
+
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_DIVIDER_HPP
@@ -10,6 +10,7 @@
 #include <boost/int128/detail/config.hpp>
 #include <boost/int128/detail/mini_to_chars.hpp>
 #include <boost/int128/int128.hpp>
+#include <algorithm>
 #include <cstring>
 #include <cstdlib>
 #include <tuple>
@@ -254,7 +255,7 @@ struct formatter
     template <typename FormatContext>
     auto format(T v, FormatContext& ctx) const
     {
-        char buffer[64];
+        char buffer[detail::mini_to_chars_binary_size];
         bool isneg {false};
         boost::int128::uint128_t abs_v {};
 
@@ -284,51 +285,22 @@ struct formatter
         }
 
         const auto end = detail::mini_to_chars(buffer, abs_v, base, is_upper);
-        std::string s(end, buffer + sizeof(buffer));
+        const auto digits {static_cast<std::size_t>(buffer + sizeof(buffer) - 1 - end)};
 
-        // Calculate prefix length that will be added later
-        std::size_t prefix_len {0};
-        if (prefix)
+        // The sign and the base prefix, which go ahead of any zero padding
+        char head[3] {};
+        std::size_t head_len {0};
+        if (isneg)
         {
-            switch (base)
-            {
-                case 2:
-                case 16:
-                    prefix_len = 2;  // "0b", "0B", "0x", or "0X"
-                    break;
-                case 8:
-                    prefix_len = 1;  // "0"
-                    break;
-                default:
-                    break;
-            }
+            head[head_len++] = '-';
         }
-
-        // Calculate sign length that will be added later
-        std::size_t sign_len {0};
-        if (sign == sign_option::plus || sign == sign_option::space || isneg)
+        else if (sign == sign_option::plus)
         {
-            sign_len = 1;
+            head[head_len++] = '+';
         }
-
-        // Zero-padding only applies when no explicit alignment is set
-        // Account for prefix and sign in the padding calculation
-        if (align == alignment::none && padding_digits > 0)
+        else if (sign == sign_option::space)
         {
-            auto target_digit_width {static_cast<std::size_t>(padding_digits)};
-            if (target_digit_width > prefix_len + sign_len)
-            {
-                target_digit_width -= prefix_len + sign_len;
-            }
-            else
-            {
-                target_digit_width = 0;
-            }
-
-            if (s.size() - 1u < target_digit_width)
-            {
-                s.insert(s.begin(), target_digit_width - s.size() + 1u, '0');
-            }
+            head[head_len++] = ' ';
         }
 
         if (prefix)
@@ -336,29 +308,15 @@ struct formatter
             switch (base)
             {
                 case 2:
-                    if (is_upper)
-                    {
-                        s.insert(s.begin(), 'B');
-                    }
-                    else
-                    {
-                        s.insert(s.begin(), 'b');
-                    }
-                    s.insert(s.begin(), '0');
+                    head[head_len++] = '0';
+                    head[head_len++] = is_upper ? 'B' : 'b';
                     break;
                 case 8:
-                    s.insert(s.begin(), '0');
+                    head[head_len++] = '0';
                     break;
                 case 16:
-                    if (is_upper)
-                    {
-                        s.insert(s.begin(), 'X');
-                    }
-                    else
-                    {
-                        s.insert(s.begin(), 'x');
-                    }
-                    s.insert(s.begin(), '0');
+                    head[head_len++] = '0';
+                    head[head_len++] = is_upper ? 'X' : 'x';
                     break;
                 default:
                     // Nothing to do
@@ -366,78 +324,48 @@ struct formatter
             }
         }
 
-        // Insert our sign
-        switch (sign)
+        const auto width {static_cast<std::size_t>(padding_digits)};
+
+        // Zero-padding only applies when no explicit alignment is set
+        // Account for prefix and sign in the padding calculation
+        std::size_t zeros {0};
+        if (align == alignment::none && width > head_len + digits)
         {
-            case sign_option::plus:
-                if (isneg)
-                {
-                    s.insert(s.begin(), '-');
-                }
-                else
-                {
-                    s.insert(s.begin(), '+');
-                }
-                break;
-            case sign_option::space:
-                if (!isneg)
-                {
-                    s.insert(s.begin(), ' ');
-                }
-                BOOST_INT128_IF_CONSTEXPR (std::is_same<T, boost::int128::int128_t>::value)
-                {
-                    if (isneg)
-                    {
-                        s.insert(s.begin(), '-');
-                    }
-                }
-                break;
-            case sign_option::negative:
-                BOOST_INT128_IF_CONSTEXPR (std::is_same<T, boost::int128::int128_t>::value)
-                {
-                    if (isneg)
-                    {
-                        s.insert(s.begin(), '-');
-                    }
-                }
-                break;
-                // LCOV_EXCL_START
-            default:
-                BOOST_INT128_UNREACHABLE;
-                // LCOV_EXCL_STOP
+            zeros = width - head_len - digits;
         }
 
-        s.erase(0, s.find_first_not_of('\0'));
-        s.erase(s.find_last_not_of('\0') + 1);
-
         // Apply alignment if specified
-        if (align != alignment::none && s.size() < static_cast<std::size_t>(padding_digits))
+        std::size_t left_fill {0};
+        std::size_t right_fill {0};
+        if (align != alignment::none && width > head_len + digits)
         {
-            auto fill_count = static_cast<std::size_t>(padding_digits) - s.size();
+            const auto fill_count {width - head_len - digits};
             switch (align)
             {
                 case alignment::left:
-                    s.append(fill_count, fill_char);
+                    right_fill = fill_count;
                     break;
                 case alignment::right:
-                    s.insert(s.begin(), fill_count, fill_char);
+                    left_fill = fill_count;
                     break;
                 case alignment::center:
-                {
-                    auto left_fill = fill_count / 2;
-                    auto right_fill = fill_count - left_fill;
-                    s.insert(s.begin(), left_fill, fill_char);
-                    s.append(right_fill, fill_char);
+                    left_fill = fill_count / 2;
+                    right_fill = fill_count - left_fill;
                     break;
-                }
-                    // LCOV_EXCL_START
+                // LCOV_EXCL_START
                 default:
                     break;
-                    // LCOV_EXCL_STOP
+                // LCOV_EXCL_STOP
             }
         }
 
-        return fmt::format_to(ctx.out(), "{}", s);
+        // Everything is written straight to the output without building an intermediate string
+        auto out {ctx.out()};
+        out = std::fill_n(out, left_fill, fill_char);
+        out = std::copy(head, head + head_len, out);
+        out = std::fill_n(out, zeros, '0');
+        out = std::copy(end, end + digits, out);
+        return std::fill_n(out, right_fill, fill_char);
     }
 };
 
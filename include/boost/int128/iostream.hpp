@@ -16,7 +16,6 @@
 #include <type_traits>
 #include <iostream>
 #include <iomanip>
-#include <cstring>
 
 #endif
 
@@ -34,34 +33,59 @@ struct streamable_overload
 template <typename T>
 BOOST_INT128_INLINE_CONSTEXPR bool is_streamable_overload_v = streamable_overload<T>::value;
 
-} // namespace detail
+// Only characters which are digits in the base are taken from the stream, so nothing ever has to be put back
+template <typename charT>
+constexpr bool is_stream_digit(const charT c, const int base) noexcept
+{
+    return base == 16 ? (c >= static_cast<charT>('0') && c <= static_cast<charT>('9')) ||
+                        (c >= static_cast<charT>('a') && c <= static_cast<charT>('f')) ||
+                        (c >= static_cast<charT>('A') && c <= static_cast<charT>('F')) :
+                        c >= static_cast<charT>('0') && c < static_cast<charT>('0' + base);
+}
 
-BOOST_INT128_EXPORT template <typename charT, typename traits, typename LibIntegerType>
-auto operator>>(std::basic_istream<charT, traits>& is, LibIntegerType& v)
-    -> std::enable_if_t<detail::is_streamable_overload_v<LibIntegerType>, std::basic_istream<charT, traits>&>
+template <typename traits>
+bool stream_write(std::basic_streambuf<char, traits>* sb, const char* first, const std::streamsize count)
 {
-    charT t_buffer[64] {};
-    is >> std::ws >> std::setw(63) >> t_buffer;
+    return sb->sputn(first, count) == count;
+}
 
-    const auto t_buffer_len {std::char_traits<charT>::length(t_buffer)};
+// Wide streams get the characters widened into a buffer of their own, which holds any output of mini_to_chars
+template <typename charT, typename traits>
+bool stream_write(std::basic_streambuf<charT, traits>* sb, const char* first, const std::streamsize count)
+{
+    charT t_buffer[64U] {};
+    for (std::streamsize i {}; i < count; ++i)
+    {
+        t_buffer[i] = static_cast<charT>(first[i]);
+    }
 
-    char buffer[64] {};
-    auto buffer_start {buffer};
+    return sb->sputn(t_buffer, count) == count;
+}
 
-    BOOST_INT128_IF_CONSTEXPR (!std::is_same<charT, char>::value)
+template <typename charT, typename traits>
+bool stream_fill(std::basic_streambuf<charT, traits>* sb, const charT fill, std::streamsize count)
+{
+    for (; count > 0; --count)
     {
-        auto first {buffer};
-        auto t_first {t_buffer};
-        const auto t_buffer_end {t_buffer + detail::strlen(t_buffer)};
-
-        while (t_first != t_buffer_end)
+        if (traits::eq_int_type(sb->sputc(fill), traits::eof()))
         {
-            *first++ = static_cast<char>(*t_first++);
+            return false;
         }
     }
-    else
+
+    return true;
+}
+
+} // namespace detail
+
+BOOST_INT128_EXPORT template <typename charT, typename traits, typename LibIntegerType>
+auto operator>>(std::basic_istream<charT, traits>& is, LibIntegerType& v)
+    -> std::enable_if_t<detail::is_streamable_overload_v<LibIntegerType>, std::basic_istream<charT, traits>&>
+{
+    const typename std::basic_istream<charT, traits>::sentry guard {is};
+    if (!guard)
     {
-        std::memcpy(buffer, t_buffer, sizeof(t_buffer));
+        return is;
     }
 
     const auto flags {is.flags()};
@@ -69,33 +93,91 @@ auto operator>>(std::basic_istream<charT, traits>& is, LibIntegerType& v)
     if (flags & std::ios_base::oct)
     {
         base = 8;
-        if (*buffer_start == '0')
-        {
-            ++buffer_start;
-        }
     }
     else if (flags & std::ios_base::hex)
     {
         base = 16;
-        if (*buffer_start == '0')
+    }
+
+    auto sb {is.rdbuf()};
+    auto c {sb->sgetc()};
+    char buffer[64] {};
+    std::size_t buffer_len {};
+
+    // A plus sign is accepted like it is for the builtin integers, but is not needed by the parser
+    if (traits::eq_int_type(c, traits::to_int_type(static_cast<charT>('-'))))
+    {
+        buffer[buffer_len++] = '-';
+        c = sb->snextc();
+    }
+    else if (traits::eq_int_type(c, traits::to_int_type(static_cast<charT>('+'))))
+    {
+        c = sb->snextc();
+    }
+
+    // A hex prefix is skipped, and may also be followed by the sign
+    if (base == 16 && traits::eq_int_type(c, traits::to_int_type(static_cast<charT>('0'))))
+    {
+        c = sb->snextc();
+        if (traits::eq_int_type(c, traits::to_int_type(static_cast<charT>('x'))) ||
+            traits::eq_int_type(c, traits::to_int_type(static_cast<charT>('X'))))
+        {
+            c = sb->snextc();
+            if (buffer_len == 0U && traits::eq_int_type(c, traits::to_int_type(static_cast<charT>('-'))))
+            {
+                buffer[buffer_len++] = '-';
+                c = sb->snextc();
+            }
+        }
+        else
         {
-            buffer_start += 2;
+            buffer[buffer_len++] = '0';
         }
     }
 
-    const auto r {detail::from_chars(buffer_start, buffer + detail::strlen(buffer), v, base)};
+    // Redundant leading zeros do not take up room in the buffer, but one is kept so that 0 still parses
+    bool leading_zero {false};
+    while (traits::eq_int_type(c, traits::to_int_type(static_cast<charT>('0'))))
+    {
+        leading_zero = true;
+        c = sb->snextc();
+    }
+
+    if (leading_zero)
+    {
+        buffer[buffer_len++] = '0';
+    }
+
+    // Every digit is consumed, and more significant digits than the buffer holds can only be an overflow
+    bool too_long {false};
+    while (!traits::eq_int_type(c, traits::eof()) && detail::is_stream_digit(traits::to_char_type(c), base))
+    {
+        if (buffer_len < sizeof(buffer))
+        {
+            buffer[buffer_len++] = static_cast<char>(traits::to_char_type(c));
+        }
+        else
+        {
+            too_long = true;
+        }
 
-    // Put back unconsumed characters
-    // If r is greater than 0 then an errno values has been hit
-    const auto consumed {static_cast<std::size_t>(r > 0 ? 0 : -r)};
-    BOOST_INT128_ASSERT(t_buffer_len >= consumed);
-    const auto return_chars {static_cast<std::size_t>(t_buffer_len - consumed)};
+        c = sb->snextc();
+    }
+
+    std::ios_base::iostate state {std::ios_base::goodbit};
+    if (traits::eq_int_type(c, traits::eof()))
+    {
+        state |= std::ios_base::eofbit;
+    }
 
-    for (std::size_t i {}; i < return_chars; ++i)
+    // If r is greater than 0 then an errno value has been hit, and the value is left unchanged
+    if (too_long || detail::from_chars(buffer, buffer + buffer_len, v, base) > 0)
     {
-        is.putback(t_buffer[t_buffer_len - i - 1]);
+        state |= std::ios_base::failbit;
     }
 
+    is.setstate(state);
+
     return is;
 }
 
@@ -103,6 +185,12 @@ BOOST_INT128_EXPORT template <typename charT, typename traits, typename LibInteg
 auto operator<<(std::basic_ostream<charT, traits>& os, const LibIntegerType& v)
     -> std::enable_if_t<detail::is_streamable_overload_v<LibIntegerType>, std::basic_ostream<charT, traits>&>
 {
+    const typename std::basic_ostream<charT, traits>::sentry guard {os};
+    if (!guard)
+    {
+        return os;
+    }
+
     char buffer[64U] {};
 
     const auto flags {os.flags()};
@@ -124,31 +212,52 @@ auto operator<<(std::basic_ostream<charT, traits>& os, const LibIntegerType& v)
 
     auto first {detail::mini_to_chars(buffer, v, base, uppercase)};
 
+    // The prefix and sign, after which internal adjustment puts the fill
+    std::streamsize head {*first == '-' ? 1 : 0};
+
     if (base == 8)
     {
+        // The octal 0 stays with the digits unless the sign follows it
         *--first = '0';
+        if (head != 0)
+        {
+            ++head;
+        }
     }
     else if (base == 16)
     {
         *--first = uppercase ? 'X' : 'x';
         *--first = '0';
+        head += 2;
     }
 
-    BOOST_INT128_IF_CONSTEXPR (!std::is_same<charT, char>::value)
-    {
-        charT t_buffer[64U] {};
+    const auto size {static_cast<std::streamsize>(buffer + sizeof(buffer) - 1 - first)};
+    const auto padding {os.width() > size ? os.width() - size : 0};
+    const auto adjust {flags & std::ios_base::adjustfield};
+    auto sb {os.rdbuf()};
 
-        auto t_first {t_buffer};
-        while (*first != '\0')
-        {
-            *t_first++ = static_cast<charT>(*first++);
-        }
-
-        os << t_buffer;
+    bool written {};
+    if (adjust == std::ios_base::left)
+    {
+        written = detail::stream_write(sb, first, size) &&
+                  detail::stream_fill(sb, os.fill(), padding);
+    }
+    else if (adjust == std::ios_base::internal)
+    {
+        written = detail::stream_write(sb, first, head) &&
+                  detail::stream_fill(sb, os.fill(), padding) &&
+                  detail::stream_write(sb, first + head, size - head);
     }
     else
     {
-        os << first;
+        written = detail::stream_fill(sb, os.fill(), padding) &&
+                  detail::stream_write(sb, first, size);
+    }
+
+    os.width(0);
+    if (!written)
+    {
+        os.setstate(std::ios_base::badbit);
     }
 
     return os;
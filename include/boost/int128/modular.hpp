@@ -0,0 +1,302 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_MODULAR_HPP
+#define BOOST_INT128_MODULAR_HPP
+
+#include <boost/int128/int128.hpp>
+#include <boost/int128/bit.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstdint>
+#include <limits>
+
+#endif
+
+namespace boost {
+namespace int128 {
+
+BOOST_INT128_EXPORT template <typename T>
+class montgomery_context;
+
+// Modular multiplication without division for an odd modulus n, using R = 2^128
+// Values are held in Montgomery form x * R mod n, which to_mont and from_mont convert to and from
+// See: Montgomery, Modular Multiplication Without Trial Division (1985)
+template <>
+class montgomery_context<uint128_t>
+{
+private:
+
+    uint128_t modulus_ {};
+    uint128_t neg_inv_ {};  // -n^-1 mod R
+    uint128_t r_mod_ {};    // R mod n, which is 1 in Montgomery form
+    uint128_t r2_mod_ {};   // R^2 mod n
+
+    constexpr uint128_t reduce(uint128_t high, uint128_t low) const noexcept;
+
+public:
+
+    // The modulus must be odd
+    explicit constexpr montgomery_context(uint128_t modulus) noexcept;
+
+    constexpr uint128_t modulus() const noexcept { return modulus_; }
+
+    // Montgomery form of 1
+    constexpr uint128_t one() const noexcept { return r_mod_; }
+
+    constexpr uint128_t to_mont(uint128_t x) const noexcept;
+
+    constexpr uint128_t from_mont(uint128_t x) const noexcept;
+
+    // The following take and return values in Montgomery form
+    constexpr uint128_t mul(uint128_t lhs, uint128_t rhs) const noexcept;
+
+    constexpr uint128_t square(uint128_t x) const noexcept;
+
+    constexpr uint128_t pow(uint128_t base, uint128_t exponent) const noexcept;
+};
+
+constexpr montgomery_context<uint128_t>::montgomery_context(const uint128_t modulus) noexcept : modulus_ {modulus}
+{
+    BOOST_INT128_ASSERT_MSG((modulus.low & 1U) == 1U, "The modulus of a montgomery_context must be odd");
+
+    // Newton's iteration for n^-1 mod 2^128 starting from n, which is its own inverse mod 8
+    // Each step doubles the number of correct low bits: 3, 6, 12, 24, 48, 96, 192
+    auto inv {modulus};
+    for (int i {}; i < 6; ++i)
+    {
+        inv *= uint128_t{0U, 2U} - modulus * inv;
+    }
+
+    neg_inv_ = -inv;
+    r_mod_ = -modulus % modulus;
+
+    // R^2 mod n = (R mod n) * R mod n
+    static_cast<void>(detail::wide_div(r_mod_, uint128_t{0U, 0U}, modulus_, r2_mod_));
+}
+
+// REDC: returns high:low * R^-1 mod n for high:low < n * R
+constexpr uint128_t montgomery_context<uint128_t>::reduce(const uint128_t high, const uint128_t low) const noexcept
+{
+    const auto m {low * neg_inv_};
+
+    uint128_t mn_high {};
+    static_cast<void>(detail::umul_wide(m, modulus_, mn_high));
+
+    // low + m * n is a multiple of R by construction, so the low half carries exactly when low is non-zero
+    auto res {high + mn_high};
+    auto overflow {res < high};
+    if (low != 0U)
+    {
+        ++res;
+        overflow = overflow || res == 0U;
+    }
+
+    // The sum is less than 2n, which may itself exceed 128 bits
+    if (overflow || res >= modulus_)
+    {
+        res -= modulus_;
+    }
+
+    return res;
+}
+
+constexpr uint128_t montgomery_context<uint128_t>::to_mont(const uint128_t x) const noexcept
+{
+    // x < R and R^2 mod n < n so the product is always in range for reduce
+    uint128_t high {};
+    const auto low {detail::umul_wide(x, r2_mod_, high)};
+    return reduce(high, low);
+}
+
+constexpr uint128_t montgomery_context<uint128_t>::from_mont(const uint128_t x) const noexcept
+{
+    return reduce(uint128_t{0U, 0U}, x);
+}
+
+constexpr uint128_t montgomery_context<uint128_t>::mul(const uint128_t lhs, const uint128_t rhs) const noexcept
+{
+    uint128_t high {};
+    const auto low {detail::umul_wide(lhs, rhs, high)};
+    return reduce(high, low);
+}
+
+constexpr uint128_t montgomery_context<uint128_t>::square(const uint128_t x) const noexcept
+{
+    uint128_t high {};
+    const auto low {detail::usquare_wide(x, high)};
+    return reduce(high, low);
+}
+
+constexpr uint128_t montgomery_context<uint128_t>::pow(const uint128_t base, const uint128_t exponent) const noexcept
+{
+    if (exponent == 0U)
+    {
+        return r_mod_;
+    }
+
+    // Left to right binary exponentiation starting below the leading one bit
+    auto res {base};
+    for (auto bit {126 - countl_zero(exponent)}; bit >= 0; --bit)
+    {
+        res = square(res);
+
+        const auto word {bit >= 64 ? exponent.high >> (bit - 64) : exponent.low >> bit};
+        if ((word & 1U) != 0U)
+        {
+            res = mul(res, base);
+        }
+    }
+
+    return res;
+}
+
+BOOST_INT128_EXPORT template <typename T>
+class modular_reducer;
+
+// Modular arithmetic for any non-zero modulus, using a precomputed reciprocal in place of division
+// The modulus is normalized so that its top bit is set, and the reciprocal is the Barrett constant
+// floor((2^256 - 1) / d) - 2^128 for the normalized modulus d, which fits in 128 bits
+// See: Moller and Granlund, Improved division by invariant integers (2011)
+template <>
+class modular_reducer<uint128_t>
+{
+private:
+
+    uint128_t modulus_ {};
+    uint128_t normalized_ {};
+    uint128_t reciprocal_ {};
+    int shift_ {};
+
+    constexpr uint128_t reduce(uint128_t high, uint128_t low) const noexcept;
+
+public:
+
+    // The modulus must be non-zero
+    explicit constexpr modular_reducer(uint128_t modulus) noexcept;
+
+    constexpr uint128_t modulus() const noexcept { return modulus_; }
+
+    // x mod modulus for any x
+    constexpr uint128_t reduce(uint128_t x) const noexcept;
+
+    // The following require their operands to be less than the modulus
+    constexpr uint128_t mulmod(uint128_t lhs, uint128_t rhs) const noexcept;
+
+    constexpr uint128_t addmod(uint128_t lhs, uint128_t rhs) const noexcept;
+
+    constexpr uint128_t submod(uint128_t lhs, uint128_t rhs) const noexcept;
+
+    // The base may be any value
+    constexpr uint128_t powmod(uint128_t base, uint128_t exponent) const noexcept;
+};
+
+constexpr modular_reducer<uint128_t>::modular_reducer(const uint128_t modulus) noexcept : modulus_ {modulus}
+{
+    BOOST_INT128_ASSERT_MSG(modulus != 0U, "The modulus of a modular_reducer must be non-zero");
+
+    shift_ = countl_zero(modulus);
+    normalized_ = modulus << shift_;
+
+    // The high word ~d is less than d since the top bit of d is set
+    uint128_t remainder {};
+    reciprocal_ = detail::wide_div(~normalized_, (std::numeric_limits<uint128_t>::max)(), normalized_, remainder);
+}
+
+// Remainder of the 256-bit value high:low, which requires high < modulus
+// This is the 2-by-1 division step of Moller and Granlund with 128-bit words, keeping only the remainder
+constexpr uint128_t modular_reducer<uint128_t>::reduce(uint128_t high, uint128_t low) const noexcept
+{
+    if (shift_ != 0)
+    {
+        high = (high << shift_) | (low >> (128 - shift_));
+        low <<= shift_;
+    }
+
+    uint128_t q1 {};
+    auto q0 {detail::umul_wide(reciprocal_, high, q1)};
+    q0 += low;
+    q1 += high + 1U + (q0 < low ? 1U : 0U);
+
+    auto r {low - q1 * normalized_};
+
+    // Taken about half the time so a mask is cheaper than a branch
+    const uint128_t mask {r > q0 ? (std::numeric_limits<uint128_t>::max)() : uint128_t{0U, 0U}};
+    r += normalized_ & mask;
+
+    if (BOOST_INT128_UNLIKELY(r >= normalized_))
+    {
+        r -= normalized_; // LCOV_EXCL_LINE
+    }
+
+    return r >> shift_;
+}
+
+constexpr uint128_t modular_reducer<uint128_t>::reduce(const uint128_t x) const noexcept
+{
+    return reduce(uint128_t{0U, 0U}, x);
+}
+
+constexpr uint128_t modular_reducer<uint128_t>::mulmod(const uint128_t lhs, const uint128_t rhs) const noexcept
+{
+    uint128_t high {};
+    const auto low {detail::umul_wide(lhs, rhs, high)};
+    return reduce(high, low);
+}
+
+constexpr uint128_t modular_reducer<uint128_t>::addmod(const uint128_t lhs, const uint128_t rhs) const noexcept
+{
+    // The sum may exceed 128 bits when the modulus is above 2^127
+    auto res {lhs + rhs};
+    if (res < lhs || res >= modulus_)
+    {
+        res -= modulus_;
+    }
+
+    return res;
+}
+
+constexpr uint128_t modular_reducer<uint128_t>::submod(const uint128_t lhs, const uint128_t rhs) const noexcept
+{
+    auto res {lhs - rhs};
+    if (lhs < rhs)
+    {
+        res += modulus_;
+    }
+
+    return res;
+}
+
+constexpr uint128_t modular_reducer<uint128_t>::powmod(uint128_t base, const uint128_t exponent) const noexcept
+{
+    base = reduce(base);
+
+    if (exponent == 0U)
+    {
+        return reduce(uint128_t{0U, 1U});
+    }
+
+    // Left to right binary exponentiation starting below the leading one bit
+    auto res {base};
+    for (auto bit {126 - countl_zero(exponent)}; bit >= 0; --bit)
+    {
+        uint128_t high {};
+        const auto low {detail::usquare_wide(res, high)};
+        res = reduce(high, low);
+
+        const auto word {bit >= 64 ? exponent.high >> (bit - 64) : exponent.low >> bit};
+        if ((word & 1U) != 0U)
+        {
+            res = mulmod(res, base);
+        }
+    }
+
+    return res;
+}
+
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_MODULAR_HPP
@@ -6,10 +6,13 @@
 #define BOOST_INT128_NUMERIC_HPP
 
 #include <boost/int128/bit.hpp>
+#include <boost/int128/cstdlib.hpp>
+#include <boost/int128/modular.hpp>
 #include <boost/int128/detail/traits.hpp>
 
 #ifndef BOOST_INT128_BUILD_MODULE
 
+#include <cstddef>
 #include <limits>
 
 #endif
@@ -50,6 +53,11 @@ BOOST_INT128_INLINE_CONSTEXPR bool is_reduced_integer_v {reduced_integers<Intege
 
 #endif // 128-bit
 
+constexpr uint128_t unsigned_abs(const int128_t x) noexcept
+{
+    return x < 0 ? -static_cast<uint128_t>(x) : static_cast<uint128_t>(x);
+}
+
 } // namespace detail
 
 BOOST_INT128_EXPORT constexpr uint128_t add_sat(const uint128_t x, const uint128_t y) noexcept
@@ -105,11 +113,12 @@ constexpr int128_t add_sat(const int128_t x, const int128_t y) noexcept
         // x < 0 and y < 0
         // Nearly the same technique as the positive values case
         constexpr auto max_value {-static_cast<uint128_t>((std::numeric_limits<int128_t>::min)())};
-        const auto big_x {static_cast<uint128_t>(abs(x))};
-        const auto big_y {static_cast<uint128_t>(abs(y))};
+        // The magnitudes can both be 2^127, in which case the sum wraps to zero
+        const auto big_x {detail::unsigned_abs(x)};
+        const auto big_y {detail::unsigned_abs(y)};
         const auto big_res {big_x + big_y};
 
-        return big_res > max_value ? (std::numeric_limits<int128_t>::min)() : -static_cast<int128_t>(big_res);
+        return (big_res > max_value || big_res < big_x) ? (std::numeric_limits<int128_t>::min)() : -static_cast<int128_t>(big_res);
     }
 }
 
@@ -121,9 +130,9 @@ constexpr int128_t sub_sat(const int128_t x, const int128_t y) noexcept
         const auto res {x - y};
         return res > x ? (std::numeric_limits<int128_t>::min)() : res;
     }
-    else if (x > 0 && y < 0)
+    else if (x >= 0 && y < 0)
     {
-        // Overflow Case
+        // Overflow Case, which includes 0 - min
         constexpr auto max_val {static_cast<uint128_t>((std::numeric_limits<int128_t>::max)())};
         const auto big_x {static_cast<uint128_t>(x)};
         const auto big_y {-static_cast<uint128_t>(y)};
@@ -191,6 +200,159 @@ BOOST_INT128_EXPORT constexpr int128_t div_sat(const int128_t x, const int128_t
     return x / y;
 }
 
+// Checked arithmetic following C23 <stdckdint.h>
+// Each function writes the result wrapped modulo 2^128 and returns true if the exact result did not fit
+
+BOOST_INT128_EXPORT constexpr bool ckd_add(uint128_t* result, const uint128_t a, const uint128_t b) noexcept
+{
+    #if defined(BOOST_INT128_HAS_INT128) && defined(BOOST_INT128_HAS_BUILTIN_ADD_OVERFLOW)
+
+    detail::builtin_u128 res {};
+    const auto overflow {__builtin_add_overflow(static_cast<detail::builtin_u128>(a), static_cast<detail::builtin_u128>(b), &res)};
+    *result = static_cast<uint128_t>(res);
+    return overflow;
+
+    #else
+
+    // operator+ is already a carry chain, and the carry out is the wrap around
+    *result = a + b;
+    return *result < a;
+
+    #endif
+}
+
+BOOST_INT128_EXPORT constexpr bool ckd_sub(uint128_t* result, const uint128_t a, const uint128_t b) noexcept
+{
+    #if defined(BOOST_INT128_HAS_INT128) && defined(BOOST_INT128_HAS_BUILTIN_SUB_OVERFLOW)
+
+    detail::builtin_u128 res {};
+    const auto overflow {__builtin_sub_overflow(static_cast<detail::builtin_u128>(a), static_cast<detail::builtin_u128>(b), &res)};
+    *result = static_cast<uint128_t>(res);
+    return overflow;
+
+    #else
+
+    *result = a - b;
+    return a < b;
+
+    #endif
+}
+
+BOOST_INT128_EXPORT constexpr bool ckd_add(int128_t* result, const int128_t a, const int128_t b) noexcept
+{
+    #if defined(BOOST_INT128_HAS_INT128) && defined(BOOST_INT128_HAS_BUILTIN_ADD_OVERFLOW)
+
+    detail::builtin_i128 res {};
+    const auto overflow {__builtin_add_overflow(static_cast<detail::builtin_i128>(a), static_cast<detail::builtin_i128>(b), &res)};
+    *result = static_cast<int128_t>(res);
+    return overflow;
+
+    #else
+
+    // Overflow happens exactly when both operands have the same sign and the result has the other
+    const auto res {static_cast<int128_t>(static_cast<uint128_t>(a) + static_cast<uint128_t>(b))};
+    *result = res;
+    return ((a.high ^ res.high) & (b.high ^ res.high)) < 0;
+
+    #endif
+}
+
+BOOST_INT128_EXPORT constexpr bool ckd_sub(int128_t* result, const int128_t a, const int128_t b) noexcept
+{
+    #if defined(BOOST_INT128_HAS_INT128) && defined(BOOST_INT128_HAS_BUILTIN_SUB_OVERFLOW)
+
+    detail::builtin_i128 res {};
+    const auto overflow {__builtin_sub_overflow(static_cast<detail::builtin_i128>(a), static_cast<detail::builtin_i128>(b), &res)};
+    *result = static_cast<int128_t>(res);
+    return overflow;
+
+    #else
+
+    // Overflow happens exactly when the operands have different signs and the result has the sign of b
+    const auto res {static_cast<int128_t>(static_cast<uint128_t>(a) - static_cast<uint128_t>(b))};
+    *result = res;
+    return ((a.high ^ b.high) & (a.high ^ res.high)) < 0;
+
+    #endif
+}
+
+namespace detail {
+
+// Writes the low 128 bits of a * b and returns whether any higher bit is set
+constexpr bool umul_overflow(uint128_t* result, const uint128_t a, const uint128_t b) noexcept
+{
+    if (a.high == 0U && b.high == 0U)
+    {
+        std::uint64_t high {};
+        const auto low {mul_64x64(a.low, b.low, high)};
+        *result = uint128_t{high, low};
+        return false;
+    }
+
+    if (a.high != 0U && b.high != 0U)
+    {
+        *result = a * b;
+        return true;
+    }
+
+    // Exactly one operand has a high word, so there is a single cross product
+    const auto big {a.high != 0U ? a : b};
+    const auto small {a.high != 0U ? b.low : a.low};
+
+    std::uint64_t low_high {};
+    const auto low {mul_64x64(big.low, small, low_high)};
+    std::uint64_t cross_high {};
+    const auto cross {mul_64x64(big.high, small, cross_high)};
+
+    const auto high {low_high + cross};
+    *result = uint128_t{high, low};
+
+    return cross_high != 0U || high < cross;
+}
+
+} // namespace detail
+
+BOOST_INT128_EXPORT constexpr bool ckd_mul(uint128_t* result, const uint128_t a, const uint128_t b) noexcept
+{
+    #if defined(BOOST_INT128_HAS_INT128) && defined(BOOST_INT128_HAS_BUILTIN_MUL_OVERFLOW)
+
+    detail::builtin_u128 res {};
+    const auto overflow {__builtin_mul_overflow(static_cast<detail::builtin_u128>(a), static_cast<detail::builtin_u128>(b), &res)};
+    *result = static_cast<uint128_t>(res);
+    return overflow;
+
+    #else
+
+    return detail::umul_overflow(result, a, b);
+
+    #endif
+}
+
+BOOST_INT128_EXPORT constexpr bool ckd_mul(int128_t* result, const int128_t a, const int128_t b) noexcept
+{
+    // Clang lowers the signed 128-bit builtin to __muloti4, which only compiler-rt provides
+    #if defined(BOOST_INT128_HAS_INT128) && defined(BOOST_INT128_HAS_BUILTIN_MUL_OVERFLOW) && !defined(__clang__)
+
+    detail::builtin_i128 res {};
+    const auto overflow {__builtin_mul_overflow(static_cast<detail::builtin_i128>(a), static_cast<detail::builtin_i128>(b), &res)};
+    *result = static_cast<int128_t>(res);
+    return overflow;
+
+    #else
+
+    // The wrapped product is the wrapped product of the magnitudes with the sign applied
+    uint128_t magnitude {};
+    const auto overflow {detail::umul_overflow(&magnitude, detail::unsigned_abs(a), detail::unsigned_abs(b))};
+    const auto negative {(a < 0) != (b < 0)};
+
+    constexpr uint128_t min_magnitude {UINT64_C(0x8000000000000000), 0U};
+    *result = static_cast<int128_t>(negative ? -magnitude : magnitude);
+
+    return overflow || magnitude > (negative ? min_magnitude : min_magnitude - 1U);
+
+    #endif
+}
+
 #ifdef _MSC_VER
 #  pragma warning(push)
 #  pragma warning(disable: 4267)
@@ -251,6 +413,22 @@ constexpr TargetType saturate_cast(const int128_t value) noexcept
 
 namespace detail {
 
+// Binary GCD of two odd values
+// Both comparisons select rather than branch, so they compile to conditional moves instead of unpredictable jumps
+constexpr std::uint64_t gcd64_odd(std::uint64_t x, std::uint64_t y) noexcept
+{
+    while (x != y)
+    {
+        // x - y has the same trailing zeros as the difference, so the count does not wait on the select
+        const auto zeros {impl::countr_impl(x - y)};
+        const auto diff {x > y ? x - y : y - x};
+        y = x < y ? x : y;
+        x = diff >> zeros;
+    }
+
+    return x;
+}
+
 constexpr std::uint64_t gcd64(std::uint64_t x, std::uint64_t y) noexcept
 {
     if (x == 0)
@@ -263,42 +441,45 @@ constexpr std::uint64_t gcd64(std::uint64_t x, std::uint64_t y) noexcept
     }
 
     const auto s {impl::countr_impl(x | y)};
-    x >>= impl::countr_impl(x);
-
-    do
-    {
-        y >>= impl::countr_impl(y);
-        if (x > y)
-        {
-            const auto temp {x};
-            x = y;
-            y = temp;
-        }
-
-        y -= x;
-    } while (y);
-
-    return x << s;
+    return gcd64_odd(x >> impl::countr_impl(x), y >> impl::countr_impl(y)) << s;
 }
 
 } // namespace detail
 
 constexpr uint128_t gcd(uint128_t a, uint128_t b) noexcept
 {
-    // Base case
-    if (a == 0U)
+    if (a < b)
     {
-        return b;
+        const auto temp {a};
+        a = b;
+        b = temp;
     }
+
+    // Base case
     if (b == 0U)
     {
         return a;
     }
 
+    // Each binary step only removes about one bit, so one remainder is cheaper when the sizes differ by much
+    if (countl_zero(b) - countl_zero(a) >= 8)
+    {
+        const auto r {a % b};
+        a = b;
+        b = r;
+
+        if (b == 0U)
+        {
+            return a;
+        }
+    }
+
+    // Operands of similar length keep the subtractive loop: its swap branch is well predicted on
+    // Fibonacci-like pairs, which are the worst case for Euclid and for Lehmer's leading-digit steps alike
     const auto a_zero {countr_zero(a)};
     const auto b_zero {countr_zero(b)};
     const auto shift {b_zero < a_zero ? b_zero : a_zero};
-    a >>= shift;
+    a >>= a_zero;
     b >>= shift;
 
     do
@@ -315,9 +496,14 @@ constexpr uint128_t gcd(uint128_t a, uint128_t b) noexcept
         b -= a;
     } while (b != 0U && (a.high | b.high) > 0U);
 
+    // The gcd itself may need more than 64 bits
+    if (b == 0U)
+    {
+        return a << shift;
+    }
+
     // Stop doing 128-bit math as soon as we can
-    const auto g {detail::gcd64(a.low, b.low)};
-    return uint128_t{0, g} << shift;
+    return uint128_t{0, detail::gcd64(a.low, b.low)} << shift;
 }
 
 constexpr int128_t gcd(const int128_t a, const int128_t b) noexcept
@@ -325,6 +511,23 @@ constexpr int128_t gcd(const int128_t a, const int128_t b) noexcept
     return static_cast<int128_t>(gcd(static_cast<uint128_t>(abs(a)), static_cast<uint128_t>(abs(b))));
 }
 
+// Element-wise gcd of n pairs, where out may be the same array as either input
+BOOST_INT128_EXPORT constexpr void gcd(const uint128_t* a, const uint128_t* b, uint128_t* out, const std::size_t n) noexcept
+{
+    for (std::size_t i {}; i < n; ++i)
+    {
+        out[i] = gcd(a[i], b[i]);
+    }
+}
+
+BOOST_INT128_EXPORT constexpr void gcd(const int128_t* a, const int128_t* b, int128_t* out, const std::size_t n) noexcept
+{
+    for (std::size_t i {}; i < n; ++i)
+    {
+        out[i] = gcd(a[i], b[i]);
+    }
+}
+
 // For unknown reasons this implementation fails for MSVC x86 only in release mode
 // Directly calculating leads to the same failures, so unfortunately we have a viable,
 // but very slow impl that we know works.
@@ -422,6 +625,781 @@ constexpr int128_t midpoint(const int128_t a, const int128_t b) noexcept
     }
 }
 
+namespace detail {
+
+// All ones when the value is negative and zero otherwise
+BOOST_INT128_FORCE_INLINE constexpr uint128_t sign_mask(const int128_t x) noexcept
+{
+    const auto word {static_cast<std::uint64_t>(x.high >> 63)};
+    return uint128_t{word, word};
+}
+
+} // namespace detail
+
+BOOST_INT128_EXPORT struct u128mul_t
+{
+    uint128_t high;
+    uint128_t low;
+};
+
+BOOST_INT128_EXPORT struct i128mul_t
+{
+    int128_t high;
+    uint128_t low;
+};
+
+// Full 256-bit product as a pair of 128-bit halves
+BOOST_INT128_EXPORT constexpr u128mul_t mul_wide(const uint128_t x, const uint128_t y) noexcept
+{
+    u128mul_t res {};
+    res.low = detail::umul_wide(x, y, res.high);
+    return res;
+}
+
+BOOST_INT128_EXPORT constexpr i128mul_t mul_wide(const int128_t x, const int128_t y) noexcept
+{
+    const auto unsigned_x {static_cast<uint128_t>(x)};
+    const auto unsigned_y {static_cast<uint128_t>(y)};
+
+    uint128_t high {};
+    const auto low {detail::umul_wide(unsigned_x, unsigned_y, high)};
+
+    // Correct the unsigned product for the two's complement interpretation of each operand
+    // The corrections are masked by the sign words, so data dependent signs cost no branches
+    high -= unsigned_y & detail::sign_mask(x);
+    high -= unsigned_x & detail::sign_mask(y);
+
+    return {static_cast<int128_t>(high), low};
+}
+
+// Upper 128 bits of the 256-bit product
+BOOST_INT128_EXPORT constexpr uint128_t mulhi(const uint128_t x, const uint128_t y) noexcept
+{
+    return detail::umulh(x, y);
+}
+
+BOOST_INT128_EXPORT constexpr int128_t mulhi(const int128_t x, const int128_t y) noexcept
+{
+    const auto unsigned_x {static_cast<uint128_t>(x)};
+    const auto unsigned_y {static_cast<uint128_t>(y)};
+
+    return static_cast<int128_t>(detail::umulh(unsigned_x, unsigned_y) - (unsigned_y & detail::sign_mask(x)) - (unsigned_x & detail::sign_mask(y)));
+}
+
+// Sum of a[i] * b[i] over n pairs of 64-bit values, computed exactly
+// Writes the sum wrapped modulo 2^128 to result and returns true if the exact sum does not fit
+//
+// Each product is split into its low word and its high word, which are summed in two separate 128-bit lanes.
+// Neither lane can overflow, so the loop carries no overflow checks and the exact sum is only formed once at the end
+BOOST_INT128_EXPORT constexpr bool accumulate_products(uint128_t* result, const std::uint64_t* a, const std::uint64_t* b, const std::size_t n) noexcept
+{
+    uint128_t low_lane {};
+    uint128_t high_lane {};
+
+    for (std::size_t i {}; i < n; ++i)
+    {
+        std::uint64_t high {};
+        const auto low {detail::mul_64x64(a[i], b[i], high)};
+        low_lane += low;
+        high_lane += high;
+    }
+
+    // Sum = high_lane * 2^64 + low_lane, which fits when the total above the low word fits in one word
+    const auto upper {high_lane + low_lane.high};
+    *result = uint128_t{upper.low, low_lane.low};
+
+    return upper.high != 0U;
+}
+
+BOOST_INT128_EXPORT constexpr bool accumulate_products(int128_t* result, const std::int64_t* a, const std::int64_t* b, const std::size_t n) noexcept
+{
+    uint128_t low_lane {};
+    int128_t high_lane {};
+
+    for (std::size_t i {}; i < n; ++i)
+    {
+        std::int64_t high {};
+        const auto low {detail::imul_64x64(a[i], b[i], high)};
+        low_lane += low;
+
+        // Widening first avoids the mixed signed operator, which branches on the sign of its operand
+        high_lane += int128_t{high};
+    }
+
+    const auto upper {high_lane + static_cast<int128_t>(low_lane.high)};
+    const auto upper_word {static_cast<std::int64_t>(upper.low)};
+    *result = int128_t{upper_word, low_lane.low};
+
+    return upper != upper_word;
+}
+
+BOOST_INT128_EXPORT enum class rounding_mode : std::uint8_t
+{
+    truncate,   // Towards zero
+    floor,      // Towards negative infinity
+    ceil,       // Towards positive infinity
+    half_even   // To nearest, with ties to even
+};
+
+namespace detail {
+
+// Quotient and remainder of a * b / c using the exact 256-bit product
+// Quotients which do not fit in 128 bits wrap, like the other arithmetic operations
+constexpr u128div_t muldiv_impl(const uint128_t a, const uint128_t b, const uint128_t c) noexcept
+{
+    auto product {mul_wide(a, b)};
+
+    // Discarding the high quotient word first keeps the 256 / 128-bit division in range
+    if (product.high >= c)
+    {
+        product.high %= c;
+    }
+
+    u128div_t res {};
+    res.quot = wide_div(product.high, product.low, c, res.rem);
+    return res;
+}
+
+// Rounds the magnitude of a truncated quotient according to mode, given the sign of the exact result
+constexpr uint128_t round_quotient(const u128div_t& res, const uint128_t divisor, const bool negative, const rounding_mode mode) noexcept
+{
+    if (res.rem == 0U)
+    {
+        return res.quot;
+    }
+
+    bool away_from_zero {false};
+
+    switch (mode)
+    {
+        case rounding_mode::truncate:
+            break;
+        case rounding_mode::floor:
+            away_from_zero = negative;
+            break;
+        case rounding_mode::ceil:
+            away_from_zero = !negative;
+            break;
+        case rounding_mode::half_even:
+        {
+            // Compare rem against divisor - rem rather than 2 * rem against divisor to avoid overflow
+            const auto gap {divisor - res.rem};
+            away_from_zero = res.rem > gap || (res.rem == gap && (res.quot.low & 1U) != 0U);
+            break;
+        }
+    }
+
+    return away_from_zero ? res.quot + 1U : res.quot;
+}
+
+} // namespace detail
+
+// Computes a * b / c without intermediate overflow
+BOOST_INT128_EXPORT constexpr uint128_t muldiv(const uint128_t a, const uint128_t b, const uint128_t c,
+                                               const rounding_mode mode = rounding_mode::truncate) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(c == 0U))
+    {
+        return {0, 0};
+    }
+
+    return detail::round_quotient(detail::muldiv_impl(a, b, c), c, false, mode);
+}
+
+BOOST_INT128_EXPORT constexpr int128_t muldiv(const int128_t a, const int128_t b, const int128_t c,
+                                              const rounding_mode mode = rounding_mode::truncate) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(c == 0))
+    {
+        return {0, 0};
+    }
+
+    const auto abs_c {detail::unsigned_abs(c)};
+    const auto negative {((a < 0) != (b < 0)) != (c < 0)};
+    const auto q {detail::round_quotient(detail::muldiv_impl(detail::unsigned_abs(a), detail::unsigned_abs(b), abs_c), abs_c, negative, mode)};
+
+    return negative ? static_cast<int128_t>(-q) : static_cast<int128_t>(q);
+}
+
+// Truncated quotient and remainder of a * b / c, where quot * c + rem == a * b
+BOOST_INT128_EXPORT constexpr u128div_t muldiv_rem(const uint128_t a, const uint128_t b, const uint128_t c) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(c == 0U))
+    {
+        return u128div_t{0U, 0U};
+    }
+
+    return detail::muldiv_impl(a, b, c);
+}
+
+BOOST_INT128_EXPORT constexpr i128div_t muldiv_rem(const int128_t a, const int128_t b, const int128_t c) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(c == 0))
+    {
+        return i128div_t{0, 0};
+    }
+
+    const auto res {detail::muldiv_impl(detail::unsigned_abs(a), detail::unsigned_abs(b), detail::unsigned_abs(c))};
+
+    // Like operator/ and operator% the remainder takes the sign of the dividend
+    const auto negative_product {(a < 0) != (b < 0)};
+    const auto negative_quotient {negative_product != (c < 0)};
+
+    return i128div_t{negative_quotient ? static_cast<int128_t>(-res.quot) : static_cast<int128_t>(res.quot),
+                     negative_product ? static_cast<int128_t>(-res.rem) : static_cast<int128_t>(res.rem)};
+}
+
+namespace detail {
+
+// Odd primes below 256, used for trial division and as Miller-Rabin witnesses
+BOOST_INT128_INLINE_CONSTEXPR std::uint32_t small_odd_primes[] {
+    3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97,
+    101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199,
+    211, 223, 227, 229, 233, 239, 241, 251
+};
+
+// Miller-Rabin with the first 13 prime bases is deterministic below psi_13 = 3317044064679887385961981
+// See: Sorenson and Webster, Strong pseudoprimes to twelve prime bases (2017)
+BOOST_INT128_INLINE_CONSTEXPR uint128_t miller_rabin_bound {UINT64_C(0x2BE69), UINT64_C(0x51ADC5B22410A5FD)};
+
+// Strong probable prime test to the given base, where n - 1 = d * 2^s with d odd
+constexpr bool is_strong_probable_prime(const montgomery_context<uint128_t>& ctx, const uint128_t d, const int s,
+                                        const std::uint32_t base) noexcept
+{
+    const auto one {ctx.one()};
+    const auto minus_one {ctx.modulus() - one};
+
+    auto x {ctx.pow(ctx.to_mont(uint128_t{base}), d)};
+    if (x == one || x == minus_one)
+    {
+        return true;
+    }
+
+    for (int r {1}; r < s; ++r)
+    {
+        x = ctx.square(x);
+        if (x == minus_one)
+        {
+            return true;
+        }
+        if (x == one)
+        {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+constexpr bool is_perfect_square(const uint128_t n) noexcept
+{
+    // Newton's iteration from above, starting at a power of two no smaller than sqrt(n)
+    auto x {uint128_t{0U, 1U} << ((129 - countl_zero(n)) / 2)};
+    while (true)
+    {
+        const auto y {(x + n / x) >> 1U};
+        if (y >= x)
+        {
+            break;
+        }
+
+        x = y;
+    }
+
+    return x * x == n;
+}
+
+// Jacobi symbol (a / n) for odd n
+constexpr int jacobi(uint128_t a, uint128_t n) noexcept
+{
+    int res {1};
+    a %= n;
+
+    while (a != 0U)
+    {
+        const auto twos {countr_zero(a)};
+        a >>= twos;
+
+        const auto n_mod_8 {n.low & 7U};
+        if ((twos & 1) != 0 && (n_mod_8 == 3U || n_mod_8 == 5U))
+        {
+            res = -res;
+        }
+
+        // Quadratic reciprocity
+        if ((a.low & 3U) == 3U && (n.low & 3U) == 3U)
+        {
+            res = -res;
+        }
+
+        const auto temp {a};
+        a = n % a;
+        n = temp;
+    }
+
+    return n == 1U ? res : 0;
+}
+
+// Residue of a small signed value
+constexpr uint128_t signed_residue(const std::int64_t value, const uint128_t n) noexcept
+{
+    return value < 0 ? n - static_cast<std::uint64_t>(-value) : uint128_t{static_cast<std::uint64_t>(value)};
+}
+
+// Strong Lucas probable prime test with Selfridge's parameters P = 1 and Q = (1 - D) / 4
+// Requires n odd, not a perfect square and free of factors below 256
+constexpr bool is_strong_lucas_probable_prime(const uint128_t n) noexcept
+{
+    // First D in 5, -7, 9, -11, ... with (D / n) = -1
+    std::int64_t d_value {5};
+    while (true)
+    {
+        const auto symbol {jacobi(signed_residue(d_value, n), n)};
+        if (symbol == -1)
+        {
+            break;
+        }
+        if (symbol == 0)
+        {
+            // |D| is much smaller than n, so they share a proper factor
+            return false;
+        }
+
+        d_value = d_value < 0 ? 2 - d_value : -2 - d_value;
+    }
+
+    const modular_reducer<uint128_t> reducer {n};
+    const auto d {signed_residue(d_value, n)};
+    const auto q {signed_residue((1 - d_value) / 4, n)};
+
+    // n + 1 = k * 2^s with k odd, which cannot overflow since 2^128 - 1 is divisible by 3
+    auto k {n + 1U};
+    const auto s {countr_zero(k)};
+    k >>= s;
+
+    // (x + n) / 2 for odd x, without overflowing
+    const auto half_n_ceil {(n >> 1U) + 1U};
+
+    uint128_t u {1U};
+    uint128_t v {1U};
+    auto qk {q};
+
+    for (auto bit {126 - countl_zero(k)}; bit >= 0; --bit)
+    {
+        // U_2k = U_k V_k and V_2k = V_k^2 - 2 Q^k
+        u = reducer.mulmod(u, v);
+        v = reducer.submod(reducer.mulmod(v, v), reducer.addmod(qk, qk));
+        qk = reducer.mulmod(qk, qk);
+
+        const auto word {bit >= 64 ? k.high >> (bit - 64) : k.low >> bit};
+        if ((word & 1U) != 0U)
+        {
+            // U_k+1 = (U_k + V_k) / 2 and V_k+1 = (D U_k + V_k) / 2
+            const auto next_u {reducer.addmod(u, v)};
+            const auto next_v {reducer.addmod(reducer.mulmod(d, u), v)};
+            u = (next_u.low & 1U) == 0U ? next_u >> 1U : (next_u >> 1U) + half_n_ceil;
+            v = (next_v.low & 1U) == 0U ? next_v >> 1U : (next_v >> 1U) + half_n_ceil;
+            qk = reducer.mulmod(qk, q);
+        }
+    }
+
+    if (u == 0U || v == 0U)
+    {
+        return true;
+    }
+
+    for (int r {1}; r < s; ++r)
+    {
+        v = reducer.submod(reducer.mulmod(v, v), reducer.addmod(qk, qk));
+        if (v == 0U)
+        {
+            return true;
+        }
+
+        qk = reducer.mulmod(qk, qk);
+    }
+
+    return false;
+}
+
+// Returns a non-trivial factor of the odd composite n using Brent's variant of Pollard's rho
+// See: Brent, An improved Monte Carlo factorization algorithm (1980)
+constexpr uint128_t pollard_brent(const uint128_t n) noexcept
+{
+    constexpr std::uint64_t batch {128U};
+
+    const montgomery_context<uint128_t> ctx {n};
+
+    // x^2 + c in Montgomery form, which may exceed 128 bits before reduction when n is above 2^127
+    for (std::uint32_t c {1U}; ; ++c)
+    {
+        const auto increment {ctx.to_mont(uint128_t{c})};
+
+        auto y {ctx.to_mont(uint128_t{2U})};
+        auto x {y};
+        auto ys {y};
+        auto q {ctx.one()};
+        uint128_t g {1U};
+
+        for (std::uint64_t r {1U}; g == 1U; r <<= 1U)
+        {
+            x = y;
+            for (std::uint64_t i {}; i < r; ++i)
+            {
+                y = ctx.square(y) + increment;
+                y = y < increment || y >= n ? y - n : y;
+            }
+
+            // Accumulate a batch of differences so that only one gcd is needed per batch
+            for (std::uint64_t k {}; k < r && g == 1U; k += batch)
+            {
+                ys = y;
+                for (std::uint64_t i {}; i < batch && i < r - k; ++i)
+                {
+                    y = ctx.square(y) + increment;
+                    y = y < increment || y >= n ? y - n : y;
+                    q = ctx.mul(q, x > y ? x - y : y - x);
+                }
+
+                g = gcd(q, n);
+            }
+        }
+
+        // The batch overshot into a full cycle, so step back through it one gcd at a time
+        if (g == n)
+        {
+            do
+            {
+                ys = ctx.square(ys) + increment;
+                ys = ys < increment || ys >= n ? ys - n : ys;
+                g = gcd(x > ys ? x - ys : ys - x, n);
+            } while (g == 1U);
+        }
+
+        if (g != n)
+        {
+            return g;
+        }
+    }
+}
+
+} // namespace detail
+
+// Deterministic below 3.3 * 10^24 (and for every n below 2^64), and the Baillie-PSW test above that,
+// for which no counterexample is known
+BOOST_INT128_EXPORT constexpr bool is_prime(const uint128_t n) noexcept
+{
+    if ((n.low & 1U) == 0U)
+    {
+        return n == 2U;
+    }
+    if (n < 3U)
+    {
+        return false;
+    }
+
+    for (const auto p : detail::small_odd_primes)
+    {
+        if (n == p)
+        {
+            return true;
+        }
+        if (n % p == 0U)
+        {
+            return false;
+        }
+    }
+
+    // Every composite below 256^2 has a factor below 256
+    if (n < UINT64_C(65536))
+    {
+        return true;
+    }
+
+    const montgomery_context<uint128_t> ctx {n};
+    auto d {n - 1U};
+    const auto s {countr_zero(d)};
+    d >>= s;
+
+    if (!detail::is_strong_probable_prime(ctx, d, s, 2U))
+    {
+        return false;
+    }
+
+    // Baillie-PSW is proven to have no pseudoprimes below 2^64
+    if (n.high != 0U && n < detail::miller_rabin_bound)
+    {
+        for (std::size_t i {}; i < 12U; ++i)
+        {
+            if (!detail::is_strong_probable_prime(ctx, d, s, detail::small_odd_primes[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    return !detail::is_perfect_square(n) && detail::is_strong_lucas_probable_prime(n);
+}
+
+// Writes the prime factors of n to out in ascending order, repeated according to their multiplicity
+// Nothing is written for 0 or 1
+BOOST_INT128_EXPORT template <typename OutputIt>
+constexpr OutputIt factor(uint128_t n, OutputIt out)
+{
+    if (n < 2U)
+    {
+        return out;
+    }
+
+    const auto twos {countr_zero(n)};
+    for (int i {}; i < twos; ++i)
+    {
+        *out++ = uint128_t{2U};
+    }
+    n >>= twos;
+
+    for (const auto p : detail::small_odd_primes)
+    {
+        if (n < uint128_t{p} * p)
+        {
+            break;
+        }
+
+        while (n % p == 0U)
+        {
+            *out++ = uint128_t{p};
+            n /= p;
+        }
+    }
+
+    // Any remaining factor exceeds 2^8, so there are at most 16 of them
+    uint128_t factors[16] {};
+    uint128_t pending[16] {};
+    std::size_t num_factors {};
+    std::size_t num_pending {};
+
+    if (n != 1U)
+    {
+        pending[num_pending++] = n;
+    }
+
+    while (num_pending > 0U)
+    {
+        const auto m {pending[--num_pending]};
+        if (is_prime(m))
+        {
+            // Insertion sort, since factors are not found in order
+            auto pos {num_factors++};
+            for (; pos > 0U && factors[pos - 1U] > m; --pos)
+            {
+                factors[pos] = factors[pos - 1U];
+            }
+            factors[pos] = m;
+        }
+        else
+        {
+            const auto divisor {detail::pollard_brent(m)};
+            pending[num_pending++] = divisor;
+            pending[num_pending++] = m / divisor;
+        }
+    }
+
+    for (std::size_t i {}; i < num_factors; ++i)
+    {
+        *out++ = factors[i];
+    }
+
+    return out;
+}
+
+BOOST_INT128_EXPORT struct i128gcd_t
+{
+    int128_t gcd;
+    int128_t x;
+    int128_t y;
+};
+
+namespace detail {
+
+// Cofactors of one pass of Lehmer's algorithm over the leading digits of u >= v
+// After an even number of steps the reduced pair is (a u - b v, d v - c u), and after an odd number (a v - b u, d u - c v)
+struct lehmer_matrix
+{
+    std::uint64_t a;
+    std::uint64_t b;
+    std::uint64_t c;
+    std::uint64_t d;
+    int steps;
+};
+
+// Runs Euclid's algorithm on the leading 62 bits of u >= v, where u >= 2^64, for as long as the quotients
+// are guaranteed to match those of the full values. The 2 spare bits keep every cofactor within 64 bits
+// See: Knuth, TAOCP Vol. 2, 4.5.2 Algorithm L and Jebelean, Improving the multiprecision Euclidean algorithm (1993)
+constexpr lehmer_matrix lehmer_step(const uint128_t u, const uint128_t v) noexcept
+{
+    const auto shift {66 - countl_zero(u)};
+    auto x {(u >> shift).low};
+    auto y {(v >> shift).low};
+
+    lehmer_matrix m {1U, 0U, 0U, 1U, 0};
+    while (y != m.c)
+    {
+        const auto q {(x + (m.a - 1U)) / (y - m.c)};
+        const auto s {m.b + q * m.d};
+        const auto qy {q * y};
+        if (qy > x || s > x - qy)
+        {
+            break;
+        }
+
+        const auto t {x - qy};
+        x = y;
+        y = t;
+
+        const auto next_d {m.a + q * m.c};
+        m.a = m.d;
+        m.b = m.c;
+        m.c = s;
+        m.d = next_d;
+        ++m.steps;
+    }
+
+    return m;
+}
+
+// Applies the matrix to a pair of remainders or a pair of cofactors, wrapping modulo 2^128
+constexpr void lehmer_apply(const lehmer_matrix& m, uint128_t& first, uint128_t& second) noexcept
+{
+    const auto prev_first {first};
+
+    if ((m.steps & 1) != 0)
+    {
+        first = second * m.a - prev_first * m.b;
+        second = prev_first * m.d - second * m.c;
+    }
+    else
+    {
+        first = prev_first * m.a - second * m.b;
+        second = second * m.d - prev_first * m.c;
+    }
+}
+
+// One step of Euclid's algorithm on the cofactors: (c0, c1) becomes (c1, c0 - q * c1)
+template <typename T>
+constexpr void euclid_cofactor_step(const T q, uint128_t& c0, uint128_t& c1) noexcept
+{
+    const auto next {c0 - c1 * q};
+    c0 = c1;
+    c1 = next;
+}
+
+// Lehmer's extended Euclidean algorithm for u >= v, returning gcd(u, v) and cofactors with u * x + v * y == gcd
+// The cofactors are computed modulo 2^128, and are exact when read as int128_t since |x| <= v / 2 and |y| <= u / 2
+constexpr uint128_t extended_gcd_impl(uint128_t u, uint128_t v, uint128_t& x, uint128_t& y) noexcept
+{
+    uint128_t x0 {1U};
+    uint128_t y0 {0U};
+    uint128_t x1 {0U};
+    uint128_t y1 {1U};
+
+    while (v.high != 0U)
+    {
+        const auto m {lehmer_step(u, v)};
+        if (m.steps == 0)
+        {
+            // The quotient is too large to find from the leading digits, so take one full step
+            const auto q {u / v};
+            const auto r {u - q * v};
+            u = v;
+            v = r;
+            euclid_cofactor_step(q, x0, x1);
+            euclid_cofactor_step(q, y0, y1);
+        }
+        else
+        {
+            lehmer_apply(m, u, v);
+            lehmer_apply(m, x0, x1);
+            lehmer_apply(m, y0, y1);
+        }
+    }
+
+    if (v == 0U)
+    {
+        x = x0;
+        y = y0;
+        return u;
+    }
+
+    if (u.high != 0U)
+    {
+        const auto q {u / v};
+        const auto r {u - q * v};
+        u = v;
+        v = r;
+        euclid_cofactor_step(q, x0, x1);
+        euclid_cofactor_step(q, y0, y1);
+    }
+
+    // Both remainders now fit in 64 bits, so only the cofactors need 128-bit arithmetic
+    auto a {u.low};
+    auto b {v.low};
+    while (b != 0U)
+    {
+        const auto q {a / b};
+        const auto r {a - q * b};
+        a = b;
+        b = r;
+        euclid_cofactor_step(q, x0, x1);
+        euclid_cofactor_step(q, y0, y1);
+    }
+
+    x = x0;
+    y = y0;
+
+    return uint128_t{a};
+}
+
+} // namespace detail
+
+// Returns gcd(a, b) >= 0 and Bezout coefficients with a * x + b * y == gcd, where |x| <= |b| / (2 gcd) and |y| <= |a| / (2 gcd)
+// The gcd must fit, so INT128_MIN may not be paired with 0 or INT128_MIN
+BOOST_INT128_EXPORT constexpr i128gcd_t extended_gcd(const int128_t a, const int128_t b) noexcept
+{
+    const auto abs_a {detail::unsigned_abs(a)};
+    const auto abs_b {detail::unsigned_abs(b)};
+
+    uint128_t x {};
+    uint128_t y {};
+    const auto g {abs_a >= abs_b ? detail::extended_gcd_impl(abs_a, abs_b, x, y) :
+                                   detail::extended_gcd_impl(abs_b, abs_a, y, x)};
+
+    BOOST_INT128_ASSERT_MSG(g.high >> 63U == 0U, "The gcd of INT128_MIN and 0 or INT128_MIN is not representable");
+
+    return i128gcd_t{static_cast<int128_t>(g),
+                     static_cast<int128_t>(a < 0 ? -x : x),
+                     static_cast<int128_t>(b < 0 ? -y : y)};
+}
+
+// Returns the inverse of a modulo m in [0, m), or 0 if there is none
+BOOST_INT128_EXPORT constexpr uint128_t mod_inverse(const uint128_t a, const uint128_t m) noexcept
+{
+    if (m <= 1U)
+    {
+        return uint128_t{0U};
+    }
+
+    uint128_t x {};
+    uint128_t y {};
+    if (detail::extended_gcd_impl(m, a % m, y, x) != 1U)
+    {
+        return uint128_t{0U};
+    }
+
+    return static_cast<int128_t>(x) < 0 ? x + m : x;
+}
+
 } // namespace int128
 } // namespace boost
 
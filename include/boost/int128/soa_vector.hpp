@@ -0,0 +1,605 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_SOA_VECTOR_HPP
+#define BOOST_INT128_SOA_VECTOR_HPP
+
+#include <boost/int128/int128.hpp>
+#include <boost/int128/batch.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#endif
+
+namespace boost {
+namespace int128 {
+
+BOOST_INT128_EXPORT template <typename T>
+class soa_vector;
+
+namespace detail {
+
+template <typename T, bool is_const>
+class soa_iterator;
+
+// Proxy for one element of a soa_vector, which reads and writes the two halves in their separate arrays
+template <typename T>
+class soa_reference
+{
+public:
+
+    using high_word_type = decltype(T{}.high);
+
+private:
+
+    std::uint64_t* low_;
+    high_word_type* high_;
+
+    constexpr soa_reference(std::uint64_t* low, high_word_type* high) noexcept : low_ {low}, high_ {high} {}
+
+    friend class soa_vector<T>;
+    friend class soa_iterator<T, false>;
+
+public:
+
+    soa_reference(const soa_reference&) = default;
+
+    constexpr operator T() const noexcept { return T{*high_, *low_}; }
+
+    constexpr soa_reference& operator=(const T value) noexcept
+    {
+        *low_ = value.low;
+        *high_ = value.high;
+        return *this;
+    }
+
+    // Assigns the referenced value, not the reference
+    constexpr soa_reference& operator=(const soa_reference& other) noexcept
+    {
+        return *this = static_cast<T>(other);
+    }
+
+    constexpr soa_reference& operator+=(const T value) noexcept { return *this = static_cast<T>(*this) + value; }
+
+    constexpr soa_reference& operator-=(const T value) noexcept { return *this = static_cast<T>(*this) - value; }
+
+    friend constexpr void swap(soa_reference lhs, soa_reference rhs) noexcept
+    {
+        const T temp {lhs};
+        lhs = static_cast<T>(rhs);
+        rhs = temp;
+    }
+};
+
+template <typename T, bool is_const>
+class soa_iterator
+{
+public:
+
+    using high_word_type = decltype(T{}.high);
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::conditional_t<is_const, T, soa_reference<T>>;
+
+private:
+
+    using low_pointer = std::conditional_t<is_const, const std::uint64_t*, std::uint64_t*>;
+    using high_pointer = std::conditional_t<is_const, const high_word_type*, high_word_type*>;
+
+    low_pointer low_ {};
+    high_pointer high_ {};
+
+    friend class soa_vector<T>;
+    friend class soa_iterator<T, !is_const>;
+
+    static constexpr T dereference(const std::uint64_t* low, const high_word_type* high) noexcept { return T{*high, *low}; }
+
+    static constexpr soa_reference<T> dereference(std::uint64_t* low, high_word_type* high) noexcept { return soa_reference<T>{low, high}; }
+
+public:
+
+    constexpr soa_iterator() noexcept = default;
+
+    constexpr soa_iterator(const low_pointer low, const high_pointer high) noexcept : low_ {low}, high_ {high} {}
+
+    // Mutable iterators convert to const iterators
+    template <bool other_const, std::enable_if_t<is_const && !other_const, bool> = true>
+    constexpr soa_iterator(const soa_iterator<T, other_const>& other) noexcept : low_ {other.low_}, high_ {other.high_} {}
+
+    constexpr reference operator*() const noexcept { return dereference(low_, high_); }
+
+    constexpr reference operator[](const difference_type n) const noexcept { return *(*this + n); }
+
+    constexpr soa_iterator& operator++() noexcept { ++low_; ++high_; return *this; }
+
+    constexpr soa_iterator operator++(int) noexcept { auto temp {*this}; ++*this; return temp; }
+
+    constexpr soa_iterator& operator--() noexcept { --low_; --high_; return *this; }
+
+    constexpr soa_iterator operator--(int) noexcept { auto temp {*this}; --*this; return temp; }
+
+    constexpr soa_iterator& operator+=(const difference_type n) noexcept { low_ += n; high_ += n; return *this; }
+
+    constexpr soa_iterator& operator-=(const difference_type n) noexcept { low_ -= n; high_ -= n; return *this; }
+
+    friend constexpr soa_iterator operator+(soa_iterator it, const difference_type n) noexcept { return it += n; }
+
+    friend constexpr soa_iterator operator+(const difference_type n, soa_iterator it) noexcept { return it += n; }
+
+    friend constexpr soa_iterator operator-(soa_iterator it, const difference_type n) noexcept { return it -= n; }
+
+    friend constexpr difference_type operator-(const soa_iterator& lhs, const soa_iterator& rhs) noexcept { return lhs.low_ - rhs.low_; }
+
+    friend constexpr bool operator==(const soa_iterator& lhs, const soa_iterator& rhs) noexcept { return lhs.low_ == rhs.low_; }
+
+    friend constexpr bool operator!=(const soa_iterator& lhs, const soa_iterator& rhs) noexcept { return lhs.low_ != rhs.low_; }
+
+    friend constexpr bool operator<(const soa_iterator& lhs, const soa_iterator& rhs) noexcept { return lhs.low_ < rhs.low_; }
+
+    friend constexpr bool operator>(const soa_iterator& lhs, const soa_iterator& rhs) noexcept { return lhs.low_ > rhs.low_; }
+
+    friend constexpr bool operator<=(const soa_iterator& lhs, const soa_iterator& rhs) noexcept { return lhs.low_ <= rhs.low_; }
+
+    friend constexpr bool operator>=(const soa_iterator& lhs, const soa_iterator& rhs) noexcept { return lhs.low_ >= rhs.low_; }
+};
+
+} // namespace detail
+
+// Sequence container of uint128_t or int128_t with the low and high words held in two separate arrays
+// Loops over the split layout vectorize without shuffling the halves of each element apart,
+// and values that fit in 64 bits leave the high array uniformly 0 (or -1)
+BOOST_INT128_EXPORT template <typename T>
+class soa_vector
+{
+    static_assert(std::is_same<T, uint128_t>::value || std::is_same<T, int128_t>::value, "soa_vector holds uint128_t or int128_t");
+
+public:
+
+    using value_type = T;
+    using high_word_type = decltype(T{}.high);
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = detail::soa_reference<T>;
+    using const_reference = T;
+    using iterator = detail::soa_iterator<T, false>;
+    using const_iterator = detail::soa_iterator<T, true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+
+    std::vector<std::uint64_t> low_;
+    std::vector<high_word_type> high_;
+
+public:
+
+    soa_vector() = default;
+
+    explicit soa_vector(const size_type count, const T value = T{}) : low_(count, value.low), high_(count, value.high) {}
+
+    template <typename InputIt, std::enable_if_t<!std::is_integral<InputIt>::value, bool> = true>
+    soa_vector(InputIt first, const InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            push_back(static_cast<T>(*first));
+        }
+    }
+
+    soa_vector(const std::initializer_list<T> values) : soa_vector(values.begin(), values.end()) {}
+
+    explicit soa_vector(const std::vector<T>& values) : soa_vector(values.begin(), values.end()) {}
+
+    std::vector<T> to_vector() const
+    {
+        return std::vector<T>(begin(), end());
+    }
+
+    // Element access
+
+    reference operator[](const size_type pos) noexcept
+    {
+        BOOST_INT128_ASSERT_MSG(pos < size(), "Index out of range");
+        return reference{low_.data() + pos, high_.data() + pos};
+    }
+
+    const_reference operator[](const size_type pos) const noexcept
+    {
+        BOOST_INT128_ASSERT_MSG(pos < size(), "Index out of range");
+        return T{high_[pos], low_[pos]};
+    }
+
+    reference front() noexcept { return (*this)[0]; }
+    const_reference front() const noexcept { return (*this)[0]; }
+
+    reference back() noexcept { return (*this)[size() - 1U]; }
+    const_reference back() const noexcept { return (*this)[size() - 1U]; }
+
+    // The two halves of every element, for kernels working on the split layout directly
+    std::uint64_t* low_data() noexcept { return low_.data(); }
+    const std::uint64_t* low_data() const noexcept { return low_.data(); }
+
+    high_word_type* high_data() noexcept { return high_.data(); }
+    const high_word_type* high_data() const noexcept { return high_.data(); }
+
+    // Iterators
+
+    iterator begin() noexcept { return iterator{low_.data(), high_.data()}; }
+    const_iterator begin() const noexcept { return const_iterator{low_.data(), high_.data()}; }
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    iterator end() noexcept { return begin() + static_cast<difference_type>(size()); }
+    const_iterator end() const noexcept { return begin() + static_cast<difference_type>(size()); }
+    const_iterator cend() const noexcept { return end(); }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator{end()}; }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{end()}; }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+    reverse_iterator rend() noexcept { return reverse_iterator{begin()}; }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator{begin()}; }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    // Capacity
+
+    bool empty() const noexcept { return low_.empty(); }
+
+    size_type size() const noexcept { return low_.size(); }
+
+    size_type capacity() const noexcept { return low_.capacity(); }
+
+    void reserve(const size_type new_capacity)
+    {
+        low_.reserve(new_capacity);
+        high_.reserve(new_capacity);
+    }
+
+    void shrink_to_fit()
+    {
+        low_.shrink_to_fit();
+        high_.shrink_to_fit();
+    }
+
+    // Modifiers
+
+    void clear() noexcept
+    {
+        low_.clear();
+        high_.clear();
+    }
+
+    void push_back(const T value)
+    {
+        low_.push_back(value.low);
+        high_.push_back(value.high);
+    }
+
+    void pop_back() noexcept
+    {
+        low_.pop_back();
+        high_.pop_back();
+    }
+
+    void resize(const size_type count, const T value = T{})
+    {
+        low_.resize(count, value.low);
+        high_.resize(count, value.high);
+    }
+
+    void swap(soa_vector& other) noexcept
+    {
+        low_.swap(other.low_);
+        high_.swap(other.high_);
+    }
+
+    friend void swap(soa_vector& lhs, soa_vector& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    friend bool operator==(const soa_vector& lhs, const soa_vector& rhs) noexcept
+    {
+        return lhs.low_ == rhs.low_ && lhs.high_ == rhs.high_;
+    }
+
+    friend bool operator!=(const soa_vector& lhs, const soa_vector& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+namespace detail {
+
+// Element-wise kernels over the split layout, where the carry of each element is a comparison of its low words
+// Each vector holds the same word of several elements, so unlike the interleaved layout no lane shuffling is needed
+
+template <bool subtract, typename HighWord>
+inline void soa_add_sub(const std::uint64_t* a_low, const HighWord* a_high,
+                        const std::uint64_t* b_low, const HighWord* b_high,
+                        std::uint64_t* out_low, HighWord* out_high, const std::size_t n) noexcept
+{
+    std::size_t i {};
+
+    #ifdef BOOST_INT128_HAS_SIMD_BATCH
+
+    for (; i + simd_words <= n; i += simd_words)
+    {
+        const simd_split lhs {simd_load(a_low + i), simd_load(a_high + i)};
+        const simd_split rhs {simd_load(b_low + i), simd_load(b_high + i)};
+        const auto res {subtract ? simd_sub(lhs, rhs) : simd_add(lhs, rhs)};
+        simd_store(out_low + i, res.low);
+        simd_store(out_high + i, res.high);
+    }
+
+    #endif
+
+    for (; i < n; ++i)
+    {
+        const auto lhs {a_low[i]};
+        const auto rhs {b_low[i]};
+        const auto carry {static_cast<std::uint64_t>(subtract ? lhs < rhs : static_cast<std::uint64_t>(lhs + rhs) < lhs)};
+
+        const auto lhs_high {static_cast<std::uint64_t>(a_high[i])};
+        const auto rhs_high {static_cast<std::uint64_t>(b_high[i])};
+
+        out_low[i] = subtract ? lhs - rhs : lhs + rhs;
+        out_high[i] = static_cast<HighWord>(subtract ? lhs_high - rhs_high - carry : lhs_high + rhs_high + carry);
+    }
+}
+
+template <typename HighWord>
+inline void soa_add_scalar(const std::uint64_t* a_low, const HighWord* a_high, const std::uint64_t b_low, const HighWord b_high,
+                           std::uint64_t* out_low, HighWord* out_high, const std::size_t n) noexcept
+{
+    std::size_t i {};
+
+    #ifdef BOOST_INT128_HAS_SIMD_BATCH
+
+    const auto rhs_words {simd_broadcast(static_cast<std::int64_t>(b_low), static_cast<std::int64_t>(b_low))};
+    const simd_split rhs {rhs_words, simd_broadcast(static_cast<std::int64_t>(b_high), static_cast<std::int64_t>(b_high))};
+
+    for (; i + simd_words <= n; i += simd_words)
+    {
+        const auto res {simd_add(simd_split{simd_load(a_low + i), simd_load(a_high + i)}, rhs)};
+        simd_store(out_low + i, res.low);
+        simd_store(out_high + i, res.high);
+    }
+
+    #endif
+
+    const auto rhs_high {static_cast<std::uint64_t>(b_high)};
+
+    for (; i < n; ++i)
+    {
+        const auto sum {a_low[i] + b_low};
+        const auto carry {static_cast<std::uint64_t>(sum < b_low)};
+
+        out_low[i] = sum;
+        out_high[i] = static_cast<HighWord>(static_cast<std::uint64_t>(a_high[i]) + rhs_high + carry);
+    }
+}
+
+// Reductions over the split layout share the kernels of the interleaved layout, without deinterleaving the loads
+
+#ifdef BOOST_INT128_HAS_SIMD_BATCH
+
+template <bool sign_extend, typename T>
+inline std::size_t soa_simd_reduce_sum(const std::uint64_t* low, const decltype(T{}.high)* high, const std::size_t n,
+                                       uint128_t& low_lane, T& high_lane) noexcept
+{
+    simd_sum_lanes lanes;
+
+    const auto end {n - n % simd_words};
+    for (std::size_t i {}; i < end; i += simd_words)
+    {
+        simd_accumulate<sign_extend>(lanes, simd_split_loader<decltype(T{}.high)>{low, high}(i));
+    }
+
+    simd_combine(lanes, low_lane, high_lane);
+
+    return end;
+}
+
+#endif // BOOST_INT128_HAS_SIMD_BATCH
+
+template <typename T>
+inline T soa_reduce_sum(const std::uint64_t* low, const decltype(T{}.high)* high, const std::size_t n) noexcept
+{
+    // Summing unsigned wraps int128_t without signed overflow
+    uint128_t sum {};
+    std::size_t i {};
+
+    #ifdef BOOST_INT128_HAS_SIMD_BATCH
+
+    uint128_t low_lane {};
+    T high_lane {};
+    i = soa_simd_reduce_sum<false>(low, high, n, low_lane, high_lane);
+
+    T simd_sum {};
+    reduce_sum_finish(&simd_sum, low_lane, high_lane);
+    sum = static_cast<uint128_t>(simd_sum);
+
+    #endif
+
+    for (; i < n; ++i)
+    {
+        sum += uint128_t{static_cast<std::uint64_t>(high[i]), low[i]};
+    }
+
+    return static_cast<T>(sum);
+}
+
+template <typename T>
+inline bool soa_reduce_sum_checked(T* result, const std::uint64_t* low, const decltype(T{}.high)* high, const std::size_t n) noexcept
+{
+    uint128_t low_lane {};
+    T high_lane {};
+    std::size_t i {};
+
+    #ifdef BOOST_INT128_HAS_SIMD_BATCH
+
+    i = soa_simd_reduce_sum<std::is_same<T, int128_t>::value>(low, high, n, low_lane, high_lane);
+
+    #endif
+
+    for (; i < n; ++i)
+    {
+        low_lane += low[i];
+        high_lane += T{high[i]};
+    }
+
+    return reduce_sum_finish(result, low_lane, high_lane);
+}
+
+template <bool is_max, typename T>
+inline T soa_reduce_min_max(const std::uint64_t* low, const decltype(T{}.high)* high, const std::size_t n) noexcept
+{
+    T result {is_max ? (std::numeric_limits<T>::min)() : (std::numeric_limits<T>::max)()};
+    std::size_t i {};
+
+    #ifdef BOOST_INT128_HAS_SIMD_BATCH
+
+    const auto end {n - n % simd_words};
+    const auto acc {simd_min_max_blocks<is_max, std::is_same<T, int128_t>::value>(simd_broadcast_split(result), end,
+                                                                                 simd_split_loader<decltype(T{}.high)>{low, high})};
+    i = end;
+
+    simd_combine<is_max>(acc, result);
+
+    #endif
+
+    for (; i < n; ++i)
+    {
+        const T value {high[i], low[i]};
+        if (is_max ? result < value : value < result)
+        {
+            result = value;
+        }
+    }
+
+    return result;
+}
+
+template <comparison op, typename T>
+inline void soa_compare(const std::uint64_t* low_words, const decltype(T{}.high)* high_words,
+                        const T low, const T high, std::uint64_t* mask, const std::size_t n) noexcept
+{
+    std::size_t i {};
+
+    #ifdef BOOST_INT128_HAS_SIMD_BATCH
+
+    i = simd_compare_words<op>(simd_split_loader<decltype(T{}.high)>{low_words, high_words}, low, high, mask, n);
+
+    #elif defined(BOOST_INT128_HAS_SSE2_BATCH)
+
+    BOOST_INT128_IF_CONSTEXPR (op == comparison::equal)
+    {
+        i = sse2_compare_eq_words(sse2_split_loader<decltype(T{}.high)>{low_words, high_words}, low, mask, n);
+    }
+
+    #endif
+
+    for (; i < n; i += 64U)
+    {
+        const auto count {n - i < 64U ? n - i : std::size_t{64U}};
+
+        std::uint64_t bits {};
+        for (std::size_t j {}; j < count; ++j)
+        {
+            bits |= static_cast<std::uint64_t>(compare_one<op>(T{high_words[i + j], low_words[i + j]}, low, high)) << j;
+        }
+
+        mask[i / 64U] = bits;
+    }
+}
+
+} // namespace detail
+
+// Element-wise arithmetic over the split layout, wrapping like the scalar operators
+// a and b must have the same size, and out is resized to match. out may be the same container as either input
+
+BOOST_INT128_EXPORT template <typename T>
+void add(const soa_vector<T>& a, const soa_vector<T>& b, soa_vector<T>& out)
+{
+    BOOST_INT128_ASSERT_MSG(a.size() == b.size(), "Operands must have the same size");
+    out.resize(a.size());
+    detail::soa_add_sub<false>(a.low_data(), a.high_data(), b.low_data(), b.high_data(), out.low_data(), out.high_data(), a.size());
+}
+
+BOOST_INT128_EXPORT template <typename T>
+void sub(const soa_vector<T>& a, const soa_vector<T>& b, soa_vector<T>& out)
+{
+    BOOST_INT128_ASSERT_MSG(a.size() == b.size(), "Operands must have the same size");
+    out.resize(a.size());
+    detail::soa_add_sub<true>(a.low_data(), a.high_data(), b.low_data(), b.high_data(), out.low_data(), out.high_data(), a.size());
+}
+
+BOOST_INT128_EXPORT template <typename T>
+void add_scalar(const soa_vector<T>& a, const typename soa_vector<T>::value_type b, soa_vector<T>& out)
+{
+    out.resize(a.size());
+    detail::soa_add_scalar(a.low_data(), a.high_data(), b.low, b.high, out.low_data(), out.high_data(), a.size());
+}
+
+// Horizontal reductions over the split layout, with the same results as for arrays
+
+BOOST_INT128_EXPORT template <typename T>
+T reduce_sum(const soa_vector<T>& a) noexcept
+{
+    return detail::soa_reduce_sum<T>(a.low_data(), a.high_data(), a.size());
+}
+
+BOOST_INT128_EXPORT template <typename T>
+bool reduce_sum_checked(T* result, const soa_vector<T>& a) noexcept
+{
+    return detail::soa_reduce_sum_checked(result, a.low_data(), a.high_data(), a.size());
+}
+
+BOOST_INT128_EXPORT template <typename T>
+T reduce_min(const soa_vector<T>& a) noexcept
+{
+    return detail::soa_reduce_min_max<false, T>(a.low_data(), a.high_data(), a.size());
+}
+
+BOOST_INT128_EXPORT template <typename T>
+T reduce_max(const soa_vector<T>& a) noexcept
+{
+    return detail::soa_reduce_min_max<true, T>(a.low_data(), a.high_data(), a.size());
+}
+
+// Filters over the split layout, where mask must hold (a.size() + 63) / 64 words
+
+BOOST_INT128_EXPORT template <typename T>
+void compare_eq(const soa_vector<T>& a, const typename soa_vector<T>::value_type value, std::uint64_t* mask) noexcept
+{
+    detail::soa_compare<detail::comparison::equal>(a.low_data(), a.high_data(), value, value, mask, a.size());
+}
+
+BOOST_INT128_EXPORT template <typename T>
+void compare_gt(const soa_vector<T>& a, const typename soa_vector<T>::value_type value, std::uint64_t* mask) noexcept
+{
+    detail::soa_compare<detail::comparison::greater>(a.low_data(), a.high_data(), value, value, mask, a.size());
+}
+
+BOOST_INT128_EXPORT template <typename T>
+void compare_between(const soa_vector<T>& a, const typename soa_vector<T>::value_type low,
+                     const typename soa_vector<T>::value_type high, std::uint64_t* mask) noexcept
+{
+    detail::soa_compare<detail::comparison::between>(a.low_data(), a.high_data(), low, high, mask, a.size());
+}
+
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_SOA_VECTOR_HPP
@@ -0,0 +1,818 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_SORT_HPP
+#define BOOST_INT128_SORT_HPP
+
+#include <boost/int128/int128.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#endif
+
+namespace boost {
+namespace int128 {
+
+namespace detail {
+
+// Radix sort on bytes, so sixteen passes cover the whole key
+BOOST_INT128_INLINE_CONSTEXPR std::size_t radix_bits {8U};
+BOOST_INT128_INLINE_CONSTEXPR std::size_t radix_buckets {std::size_t{1U} << radix_bits};
+BOOST_INT128_INLINE_CONSTEXPR std::size_t radix_passes {128U / radix_bits};
+BOOST_INT128_INLINE_CONSTEXPR std::size_t radix_word_passes {64U / radix_bits};
+
+// Below this many elements clearing and summing the histograms costs more than the sort itself
+BOOST_INT128_INLINE_CONSTEXPR std::size_t radix_insertion_threshold {64U};
+
+// Scattering into 256 buckets is several times slower once the keys (a megabyte at this threshold) no longer fit in the cache,
+// so larger ranges are first split on their most significant digit until the pieces do fit
+BOOST_INT128_INLINE_CONSTEXPR std::size_t radix_cache_threshold {65536U};
+
+// Stands in for the values when only the keys are sorted
+struct radix_no_values {};
+
+// Flipping the sign bit makes the unsigned order of the digits match the order of int128_t keys
+template <typename T>
+BOOST_INT128_FORCE_INLINE std::size_t radix_digit(const T key, const std::size_t pass) noexcept
+{
+    constexpr std::uint64_t sign_bit {std::is_same<T, int128_t>::value ? UINT64_C(0x8000000000000000) : UINT64_C(0)};
+
+    const auto word {pass < radix_word_passes ? key.low : static_cast<std::uint64_t>(key.high) ^ sign_bit};
+    return static_cast<std::size_t>(word >> ((pass % radix_word_passes) * radix_bits)) & (radix_buckets - 1U);
+}
+
+// Offsetting a null pointer is undefined, so the placeholder values never move
+template <typename Value>
+BOOST_INT128_FORCE_INLINE Value* radix_advance(Value* values, const std::size_t offset) noexcept
+{
+    return values + offset;
+}
+
+BOOST_INT128_FORCE_INLINE radix_no_values* radix_advance(radix_no_values* values, std::size_t) noexcept
+{
+    return values;
+}
+
+template <typename T, typename Value>
+void insertion_sort(T* keys, Value* values, const std::size_t n)
+{
+    constexpr bool has_values {!std::is_same<Value, radix_no_values>::value};
+
+    for (std::size_t i {1U}; i < n; ++i)
+    {
+        const auto key {keys[i]};
+        std::size_t j {i};
+
+        if (key < keys[j - 1U])
+        {
+            Value value {};
+            BOOST_INT128_IF_CONSTEXPR (has_values)
+            {
+                value = std::move(values[i]);
+            }
+
+            do
+            {
+                keys[j] = keys[j - 1U];
+                BOOST_INT128_IF_CONSTEXPR (has_values)
+                {
+                    values[j] = std::move(values[j - 1U]);
+                }
+                --j;
+            } while (j > 0U && key < keys[j - 1U]);
+
+            keys[j] = key;
+            BOOST_INT128_IF_CONSTEXPR (has_values)
+            {
+                values[j] = std::move(value);
+            }
+        }
+    }
+}
+
+// A single read of the keys builds the histograms of the lowest passes
+template <typename T>
+void radix_count(const T* keys, const std::size_t n, std::size_t* counts, const std::size_t passes) noexcept
+{
+    for (std::size_t i {}; i < passes * radix_buckets; ++i)
+    {
+        counts[i] = 0U;
+    }
+
+    for (std::size_t i {}; i < n; ++i)
+    {
+        const auto key {keys[i]};
+        for (std::size_t pass {}; pass < passes; ++pass)
+        {
+            ++counts[pass * radix_buckets + radix_digit(key, pass)];
+        }
+    }
+}
+
+// Digits shared by all n keys leave the order unchanged, so only the passes below the highest differing digit are needed
+template <typename T>
+std::size_t radix_needed_passes(const T key, const std::size_t n, const std::size_t* counts, std::size_t passes) noexcept
+{
+    while (passes > 0U && counts[(passes - 1U) * radix_buckets + radix_digit(key, passes - 1U)] == n)
+    {
+        --passes;
+    }
+
+    return passes;
+}
+
+template <typename T>
+std::size_t radix_histograms(const T* keys, const std::size_t n, std::size_t* counts, const std::size_t passes) noexcept
+{
+    radix_count(keys, n, counts, passes);
+    return radix_needed_passes(keys[0], n, counts, passes);
+}
+
+// Turns the counts of one pass into the offset of each bucket
+inline void radix_offsets(std::size_t* offsets) noexcept
+{
+    std::size_t total {};
+    for (std::size_t bucket {}; bucket < radix_buckets; ++bucket)
+    {
+        const auto count {offsets[bucket]};
+        offsets[bucket] = total;
+        total += count;
+    }
+}
+
+// Moves every element to the next free slot of its bucket
+// Scattering in input order keeps the sort stable, which the later passes rely on
+template <typename T, typename Value>
+void radix_scatter(const T* src, Value* src_values, T* dst, Value* dst_values,
+                   const std::size_t n, std::size_t* offsets, const std::size_t pass)
+{
+    constexpr bool has_values {!std::is_same<Value, radix_no_values>::value};
+
+    for (std::size_t i {}; i < n; ++i)
+    {
+        const auto pos {offsets[radix_digit(src[i], pass)]++};
+        dst[pos] = src[i];
+        BOOST_INT128_IF_CONSTEXPR (has_values)
+        {
+            dst_values[pos] = std::move(src_values[i]);
+        }
+    }
+}
+
+template <typename T, typename Value>
+void radix_move(T* src, Value* src_values, T* dst, Value* dst_values, const std::size_t n)
+{
+    constexpr bool has_values {!std::is_same<Value, radix_no_values>::value};
+
+    for (std::size_t i {}; i < n; ++i)
+    {
+        dst[i] = src[i];
+        BOOST_INT128_IF_CONSTEXPR (has_values)
+        {
+            dst_values[i] = std::move(src_values[i]);
+        }
+    }
+}
+
+// Sorts on the digits of the lowest passes, using the buffers of the same length as scratch space.
+// Ranges which fit in the cache go least significant digit first,
+// and larger ones are partitioned on their highest differing digit with each bucket sorted in turn
+template <typename T, typename Value>
+void radix_sort_range(T* keys, Value* values, T* key_buffer, Value* value_buffer,
+                      const std::size_t n, std::size_t* counts, std::size_t passes)
+{
+    if (n < radix_insertion_threshold)
+    {
+        insertion_sort(keys, values, n);
+        return;
+    }
+
+    passes = radix_histograms(keys, n, counts, passes);
+    if (passes == 0U)
+    {
+        return;
+    }
+
+    if (n <= radix_cache_threshold)
+    {
+        T* src {keys};
+        T* dst {key_buffer};
+        Value* src_values {values};
+        Value* dst_values {value_buffer};
+
+        for (std::size_t pass {}; pass < passes; ++pass)
+        {
+            auto* offsets {counts + pass * radix_buckets};
+            if (offsets[radix_digit(src[0], pass)] == n)
+            {
+                continue;
+            }
+
+            radix_offsets(offsets);
+            radix_scatter(src, src_values, dst, dst_values, n, offsets, pass);
+            std::swap(src, dst);
+            std::swap(src_values, dst_values);
+        }
+
+        if (src != keys)
+        {
+            radix_move(src, src_values, keys, values, n);
+        }
+
+        return;
+    }
+
+    // The recursion below reuses the histograms, so this level keeps its own copy of the bucket sizes
+    const auto pass {passes - 1U};
+    std::size_t offsets[radix_buckets];
+    std::size_t sizes[radix_buckets];
+    for (std::size_t bucket {}; bucket < radix_buckets; ++bucket)
+    {
+        offsets[bucket] = counts[pass * radix_buckets + bucket];
+        sizes[bucket] = offsets[bucket];
+    }
+
+    radix_offsets(offsets);
+    radix_scatter(keys, values, key_buffer, value_buffer, n, offsets, pass);
+    radix_move(key_buffer, value_buffer, keys, values, n);
+
+    std::size_t start {};
+    for (std::size_t bucket {}; bucket < radix_buckets; ++bucket)
+    {
+        if (sizes[bucket] > 1U)
+        {
+            radix_sort_range(keys + start, radix_advance(values, start), key_buffer + start,
+                             radix_advance(value_buffer, start), sizes[bucket], counts, pass);
+        }
+
+        start += sizes[bucket];
+    }
+}
+
+template <typename T, typename Value>
+void radix_sort_impl(T* keys, Value* values, const std::size_t n)
+{
+    constexpr bool has_values {!std::is_same<Value, radix_no_values>::value};
+
+    if (n < radix_insertion_threshold)
+    {
+        insertion_sort(keys, values, n);
+        return;
+    }
+
+    std::unique_ptr<std::size_t[]> counts {new std::size_t[radix_passes * radix_buckets]};
+    std::unique_ptr<T[]> key_buffer {new T[n]};
+    std::unique_ptr<Value[]> value_buffer {has_values ? new Value[n] : nullptr};
+
+    radix_sort_range(keys, values, key_buffer.get(), value_buffer.get(), n, counts.get(), radix_passes);
+}
+
+// Each thread of a parallel sort or merge gets at least this many keys, so that starting it pays off
+BOOST_INT128_INLINE_CONSTEXPR std::size_t parallel_grain {65536U};
+
+BOOST_INT128_INLINE_CONSTEXPR std::size_t radix_counts_stride {radix_passes * radix_buckets};
+
+inline unsigned parallel_threads(const unsigned threads, const std::size_t n) noexcept
+{
+    const auto limit {n / parallel_grain};
+    if (threads == 0U || limit <= 1U)
+    {
+        return 1U;
+    }
+
+    return limit < threads ? static_cast<unsigned>(limit) : threads;
+}
+
+// Start of the thread-th of threads nearly equal chunks of n elements
+inline std::size_t parallel_chunk(const std::size_t n, const unsigned threads, const unsigned thread) noexcept
+{
+    const auto remainder {n % threads};
+    return n / threads * thread + (thread < remainder ? thread : remainder);
+}
+
+// Runs body(thread) for every thread, on new threads and the calling thread, and waits for all of them.
+// If a thread cannot be started, its chunk and every later one run on the calling thread instead.
+template <typename Body>
+void parallel_run(Body& body, const unsigned threads)
+{
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1U);
+
+    struct joiner
+    {
+        std::vector<std::thread>& workers;
+
+        ~joiner()
+        {
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+        }
+    } guard {workers};
+
+    unsigned started {1U};
+    try
+    {
+        for (; started < threads; ++started)
+        {
+            workers.emplace_back(std::ref(body), started);
+        }
+    }
+    catch (const std::system_error&)
+    {
+        // Out of threads, the chunks from started on are finished inline below
+    }
+
+    body(0U);
+
+    for (unsigned thread {started}; thread < threads; ++thread)
+    {
+        body(thread);
+    }
+}
+
+template <typename T>
+struct parallel_count
+{
+    const T* keys;
+    std::size_t n;
+    std::size_t* counts;
+    std::size_t passes;
+    unsigned threads;
+
+    void operator()(const unsigned thread) const noexcept
+    {
+        const auto begin {parallel_chunk(n, threads, thread)};
+        const auto end {parallel_chunk(n, threads, thread + 1U)};
+        radix_count(keys + begin, end - begin, counts + thread * radix_counts_stride, passes);
+    }
+};
+
+template <typename T, typename Value>
+struct parallel_scatter
+{
+    T* keys;
+    Value* values;
+    T* key_buffer;
+    Value* value_buffer;
+    std::size_t n;
+    std::size_t* counts;
+    std::size_t pass;
+    unsigned threads;
+
+    void operator()(const unsigned thread) const
+    {
+        const auto begin {parallel_chunk(n, threads, thread)};
+        const auto end {parallel_chunk(n, threads, thread + 1U)};
+        radix_scatter(keys + begin, radix_advance(values, begin), key_buffer, value_buffer, end - begin,
+                      counts + thread * radix_counts_stride + pass * radix_buckets, pass);
+    }
+};
+
+template <typename T, typename Value>
+struct parallel_move
+{
+    T* src;
+    Value* src_values;
+    T* dst;
+    Value* dst_values;
+    std::size_t n;
+    unsigned threads;
+
+    void operator()(const unsigned thread) const
+    {
+        const auto begin {parallel_chunk(n, threads, thread)};
+        const auto end {parallel_chunk(n, threads, thread + 1U)};
+        radix_move(src + begin, radix_advance(src_values, begin), dst + begin, radix_advance(dst_values, begin), end - begin);
+    }
+};
+
+// The buckets are independent, so idle threads take the next one from a shared queue,
+// which is ordered largest first so that no thread is left with a big bucket at the end
+template <typename T, typename Value>
+struct parallel_buckets
+{
+    T* keys;
+    Value* values;
+    T* key_buffer;
+    Value* value_buffer;
+    std::size_t* counts;
+    std::size_t pass;
+    const std::size_t* starts;
+    const std::size_t* sizes;
+    const std::size_t* queue;
+    std::size_t queued;
+    std::atomic<std::size_t>* next;
+
+    void operator()(const unsigned thread) const
+    {
+        for (auto i {next->fetch_add(1U)}; i < queued; i = next->fetch_add(1U))
+        {
+            const auto start {starts[queue[i]]};
+            radix_sort_range(keys + start, radix_advance(values, start), key_buffer + start, radix_advance(value_buffer, start),
+                             sizes[queue[i]], counts + thread * radix_counts_stride, pass);
+        }
+    }
+};
+
+struct larger_bucket
+{
+    const std::size_t* sizes;
+
+    bool operator()(const std::size_t lhs, const std::size_t rhs) const noexcept
+    {
+        return sizes[lhs] > sizes[rhs];
+    }
+};
+
+// Partitions the range on its highest differing digit with every thread scattering its own chunk,
+// then sorts the buckets in parallel. A bucket too big to leave to one thread is sorted by all of them in turn.
+// counts holds the histograms of each thread, followed by their totals
+template <typename T, typename Value>
+void parallel_radix_sort_range(T* keys, Value* values, T* key_buffer, Value* value_buffer,
+                               const std::size_t n, std::size_t* counts, std::size_t passes, const unsigned max_threads)
+{
+    const auto threads {parallel_threads(max_threads, n)};
+    if (threads == 1U)
+    {
+        radix_sort_range(keys, values, key_buffer, value_buffer, n, counts, passes);
+        return;
+    }
+
+    parallel_count<T> count {keys, n, counts, passes, threads};
+    parallel_run(count, threads);
+
+    auto* totals {counts + max_threads * radix_counts_stride};
+    for (std::size_t i {}; i < passes * radix_buckets; ++i)
+    {
+        totals[i] = 0U;
+        for (unsigned thread {}; thread < threads; ++thread)
+        {
+            totals[i] += counts[thread * radix_counts_stride + i];
+        }
+    }
+
+    passes = radix_needed_passes(keys[0], n, totals, passes);
+    if (passes == 0U)
+    {
+        return;
+    }
+
+    // Each thread scatters its chunk after the elements of the same bucket from the chunks before it
+    const auto pass {passes - 1U};
+    std::size_t starts[radix_buckets];
+    std::size_t sizes[radix_buckets];
+    std::size_t start {};
+    for (std::size_t bucket {}; bucket < radix_buckets; ++bucket)
+    {
+        starts[bucket] = start;
+        sizes[bucket] = totals[pass * radix_buckets + bucket];
+
+        for (unsigned thread {}; thread < threads; ++thread)
+        {
+            auto& offset {counts[thread * radix_counts_stride + pass * radix_buckets + bucket]};
+            const auto thread_count {offset};
+            offset = start;
+            start += thread_count;
+        }
+    }
+
+    parallel_scatter<T, Value> scatter {keys, values, key_buffer, value_buffer, n, counts, pass, threads};
+    parallel_run(scatter, threads);
+
+    parallel_move<T, Value> move {key_buffer, value_buffer, keys, values, n, threads};
+    parallel_run(move, threads);
+
+    std::size_t queue[radix_buckets];
+    std::size_t queued {};
+    for (std::size_t bucket {}; bucket < radix_buckets; ++bucket)
+    {
+        if (sizes[bucket] > 1U && sizes[bucket] <= n / threads)
+        {
+            queue[queued++] = bucket;
+        }
+    }
+    std::sort(queue, queue + queued, larger_bucket {sizes});
+
+    std::atomic<std::size_t> next {0U};
+    parallel_buckets<T, Value> buckets {keys, values, key_buffer, value_buffer, counts, pass, starts, sizes, queue, queued, &next};
+    parallel_run(buckets, threads);
+
+    for (std::size_t bucket {}; bucket < radix_buckets; ++bucket)
+    {
+        if (sizes[bucket] > n / threads)
+        {
+            parallel_radix_sort_range(keys + starts[bucket], radix_advance(values, starts[bucket]),
+                                      key_buffer + starts[bucket], radix_advance(value_buffer, starts[bucket]),
+                                      sizes[bucket], counts, pass, max_threads);
+        }
+    }
+}
+
+template <typename T, typename Value>
+void parallel_radix_sort_impl(T* keys, Value* values, const std::size_t n, unsigned threads)
+{
+    constexpr bool has_values {!std::is_same<Value, radix_no_values>::value};
+
+    if (threads == 0U)
+    {
+        threads = std::thread::hardware_concurrency();
+    }
+
+    if (parallel_threads(threads, n) == 1U)
+    {
+        radix_sort_impl(keys, values, n);
+        return;
+    }
+
+    // A recursive call never uses more threads than the first one
+    threads = parallel_threads(threads, n);
+
+    std::unique_ptr<std::size_t[]> counts {new std::size_t[(threads + std::size_t{1U}) * radix_counts_stride]};
+    std::unique_ptr<T[]> key_buffer {new T[n]};
+    std::unique_ptr<Value[]> value_buffer {has_values ? new Value[n] : nullptr};
+
+    parallel_radix_sort_range(keys, values, key_buffer.get(), value_buffer.get(), n, counts.get(), radix_passes, threads);
+}
+
+// Maps the keys onto uint128_t in the same order, so that a merge can bisect the range of keys
+template <typename T>
+BOOST_INT128_FORCE_INLINE uint128_t merge_order(const T key) noexcept
+{
+    constexpr uint128_t sign_bit {std::is_same<T, int128_t>::value ? UINT64_C(0x8000000000000000) : UINT64_C(0), UINT64_C(0)};
+    return static_cast<uint128_t>(key) ^ sign_bit;
+}
+
+template <typename T>
+BOOST_INT128_FORCE_INLINE T merge_key(const uint128_t order) noexcept
+{
+    constexpr uint128_t sign_bit {std::is_same<T, int128_t>::value ? UINT64_C(0x8000000000000000) : UINT64_C(0), UINT64_C(0)};
+    return static_cast<T>(order ^ sign_bit);
+}
+
+// Finds where to cut each run so that the first rank elements of the merged output come before the cuts.
+// The smallest key with at least rank elements no greater than it is found by bisection,
+// and the elements equal to it are taken from the earlier runs first, which is the order the merge emits them in
+template <typename T>
+void merge_cuts(const T* keys, const std::size_t* bounds, const std::size_t runs, const std::size_t rank, std::size_t* cuts)
+{
+    uint128_t low {UINT64_MAX, UINT64_MAX};
+    uint128_t high {};
+    for (std::size_t run {}; run < runs; ++run)
+    {
+        cuts[run] = bounds[run];
+        if (bounds[run] < bounds[run + 1U])
+        {
+            low = merge_order(keys[bounds[run]]) < low ? merge_order(keys[bounds[run]]) : low;
+            high = merge_order(keys[bounds[run + 1U] - 1U]) > high ? merge_order(keys[bounds[run + 1U] - 1U]) : high;
+        }
+    }
+
+    if (rank == 0U)
+    {
+        return;
+    }
+
+    while (low < high)
+    {
+        const auto middle {low + (high - low) / 2U};
+        const auto key {merge_key<T>(middle)};
+
+        std::size_t count {};
+        for (std::size_t run {}; run < runs; ++run)
+        {
+            count += static_cast<std::size_t>(std::upper_bound(keys + bounds[run], keys + bounds[run + 1U], key) - (keys + bounds[run]));
+        }
+
+        if (count >= rank)
+        {
+            high = middle;
+        }
+        else
+        {
+            low = middle + 1U;
+        }
+    }
+
+    const auto key {merge_key<T>(low)};
+    std::size_t taken {};
+    for (std::size_t run {}; run < runs; ++run)
+    {
+        cuts[run] = static_cast<std::size_t>(std::lower_bound(keys + bounds[run], keys + bounds[run + 1U], key) - keys);
+        taken += cuts[run] - bounds[run];
+    }
+
+    for (std::size_t run {}; run < runs && taken < rank; ++run)
+    {
+        const auto equal_end {static_cast<std::size_t>(std::upper_bound(keys + cuts[run], keys + bounds[run + 1U], key) - keys)};
+        const auto take {equal_end - cuts[run] < rank - taken ? equal_end - cuts[run] : rank - taken};
+        cuts[run] += take;
+        taken += take;
+    }
+}
+
+// Equal keys come from the earlier run first, which keeps the merge stable
+template <typename T>
+BOOST_INT128_FORCE_INLINE bool merge_before(const T* keys, const std::size_t* positions, const std::size_t lhs, const std::size_t rhs) noexcept
+{
+    const auto lhs_key {keys[positions[lhs]]};
+    const auto rhs_key {keys[positions[rhs]]};
+    return lhs_key < rhs_key || (lhs_key == rhs_key && lhs < rhs);
+}
+
+template <typename T>
+void merge_sift_down(const T* keys, const std::size_t* positions, std::size_t* heap, const std::size_t size, std::size_t i) noexcept
+{
+    const auto run {heap[i]};
+    for (auto child {2U * i + 1U}; child < size; child = 2U * i + 1U)
+    {
+        if (child + 1U < size && merge_before(keys, positions, heap[child + 1U], heap[child]))
+        {
+            ++child;
+        }
+
+        if (!merge_before(keys, positions, heap[child], run))
+        {
+            break;
+        }
+
+        heap[i] = heap[child];
+        i = child;
+    }
+
+    heap[i] = run;
+}
+
+// Merges the runs [positions[run], ends[run]) into out with a binary heap of run indices
+template <typename T>
+void merge_runs(const T* keys, std::size_t* positions, const std::size_t* ends, std::size_t* heap, const std::size_t runs, T* out) noexcept
+{
+    std::size_t size {};
+    for (std::size_t run {}; run < runs; ++run)
+    {
+        if (positions[run] < ends[run])
+        {
+            heap[size++] = run;
+        }
+    }
+
+    for (auto i {size / 2U}; i-- > 0U;)
+    {
+        merge_sift_down(keys, positions, heap, size, i);
+    }
+
+    // Once a single run is left the rest of it is copied in one go
+    while (size > 1U)
+    {
+        const auto run {heap[0]};
+        *out++ = keys[positions[run]++];
+
+        if (positions[run] == ends[run])
+        {
+            heap[0] = heap[--size];
+        }
+
+        merge_sift_down(keys, positions, heap, size, 0U);
+    }
+
+    if (size == 1U)
+    {
+        std::copy(keys + positions[heap[0]], keys + ends[heap[0]], out);
+    }
+}
+
+// Every thread finds the cuts at both ends of its share of the output on its own, and merges between them
+template <typename T>
+struct parallel_merge_chunk
+{
+    const T* keys;
+    const std::size_t* bounds;
+    std::size_t runs;
+    T* out;
+    std::size_t* scratch;
+    unsigned threads;
+
+    void operator()(const unsigned thread) const
+    {
+        const auto total {bounds[runs] - bounds[0]};
+        const auto begin {parallel_chunk(total, threads, thread)};
+        const auto end {parallel_chunk(total, threads, thread + 1U)};
+
+        auto* positions {scratch + thread * 3U * runs};
+        auto* ends {positions + runs};
+        auto* heap {ends + runs};
+
+        merge_cuts(keys, bounds, runs, begin, positions);
+        merge_cuts(keys, bounds, runs, end, ends);
+        merge_runs(keys, positions, ends, heap, runs, out + begin);
+    }
+};
+
+template <typename T>
+void parallel_merge_impl(const T* keys, const std::size_t* bounds, const std::size_t runs, T* out, unsigned threads)
+{
+    if (runs == 0U)
+    {
+        return;
+    }
+
+    if (threads == 0U)
+    {
+        threads = std::thread::hardware_concurrency();
+    }
+    threads = parallel_threads(threads, bounds[runs] - bounds[0]);
+
+    std::unique_ptr<std::size_t[]> scratch {new std::size_t[threads * 3U * runs]};
+    parallel_merge_chunk<T> merge {keys, bounds, runs, out, scratch.get(), threads};
+    parallel_run(merge, threads);
+}
+
+} // namespace detail
+
+// Sorts n keys into ascending order. The sort allocates a buffer the size of the input, and throws std::bad_alloc if that fails
+
+BOOST_INT128_EXPORT inline void radix_sort(uint128_t* keys, const std::size_t n)
+{
+    detail::radix_sort_impl(keys, static_cast<detail::radix_no_values*>(nullptr), n);
+}
+
+BOOST_INT128_EXPORT inline void radix_sort(int128_t* keys, const std::size_t n)
+{
+    detail::radix_sort_impl(keys, static_cast<detail::radix_no_values*>(nullptr), n);
+}
+
+// Sorts n keys and applies the same permutation to values, such as the row ids of the keys
+// The sort is stable, so values with equal keys keep their relative order
+// Value must be default constructible and move assignable
+
+BOOST_INT128_EXPORT template <typename Value>
+void radix_sort(uint128_t* keys, Value* values, const std::size_t n)
+{
+    detail::radix_sort_impl(keys, values, n);
+}
+
+BOOST_INT128_EXPORT template <typename Value>
+void radix_sort(int128_t* keys, Value* values, const std::size_t n)
+{
+    detail::radix_sort_impl(keys, values, n);
+}
+
+// Sorts n keys like radix_sort, on up to threads threads, or std::thread::hardware_concurrency() of them when threads is zero
+// Each thread handles at least 65536 keys, so smaller inputs are sorted on the calling thread
+// Moving a Value must not throw, since the values are moved on the worker threads
+
+BOOST_INT128_EXPORT inline void parallel_radix_sort(uint128_t* keys, const std::size_t n, const unsigned threads = 0U)
+{
+    detail::parallel_radix_sort_impl(keys, static_cast<detail::radix_no_values*>(nullptr), n, threads);
+}
+
+BOOST_INT128_EXPORT inline void parallel_radix_sort(int128_t* keys, const std::size_t n, const unsigned threads = 0U)
+{
+    detail::parallel_radix_sort_impl(keys, static_cast<detail::radix_no_values*>(nullptr), n, threads);
+}
+
+BOOST_INT128_EXPORT template <typename Value>
+void parallel_radix_sort(uint128_t* keys, Value* values, const std::size_t n, const unsigned threads = 0U)
+{
+    detail::parallel_radix_sort_impl(keys, values, n, threads);
+}
+
+BOOST_INT128_EXPORT template <typename Value>
+void parallel_radix_sort(int128_t* keys, Value* values, const std::size_t n, const unsigned threads = 0U)
+{
+    detail::parallel_radix_sort_impl(keys, values, n, threads);
+}
+
+// Merges the sorted runs [keys + bounds[i], keys + bounds[i + 1]) for i < runs into out, which holds bounds[runs] - bounds[0] keys
+// Equal keys keep the order of their runs. The output is split between the threads by rank, so the runs may differ in length
+
+BOOST_INT128_EXPORT inline void parallel_merge(const uint128_t* keys, const std::size_t* bounds, const std::size_t runs,
+                                               uint128_t* out, const unsigned threads = 0U)
+{
+    detail::parallel_merge_impl(keys, bounds, runs, out, threads);
+}
+
+BOOST_INT128_EXPORT inline void parallel_merge(const int128_t* keys, const std::size_t* bounds, const std::size_t runs,
+                                               int128_t* out, const unsigned threads = 0U)
+{
+    detail::parallel_merge_impl(keys, bounds, runs, out, threads);
+}
+
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_SORT_HPP
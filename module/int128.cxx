@@ -14,6 +14,15 @@ module;
 #include <cerrno>
 #include <cstddef>
 #include <compare>
+#include <initializer_list>
+#include <iterator>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <system_error>
+#include <thread>
+#include <memory>
+#include <vector>
 
 #if __has_include(<__msvc_int128.hpp>) && _MSVC_LANG >= 202002L
 
@@ -62,6 +71,11 @@ class numeric_limits<boost::int128::uint128_t>;
 #endif
 
 #include <boost/int128.hpp>
+#include <boost/int128/batch.hpp>
+#include <boost/int128/divider.hpp>
+#include <boost/int128/modular.hpp>
+#include <boost/int128/soa_vector.hpp>
+#include <boost/int128/sort.hpp>
 
 #ifdef _MSC_VER
 #  pragma warning( pop )
@@ -337,6 +337,52 @@ BOOST_INT128_NO_INLINE void test_two_element_operation(const std::vector<T>& dat
     std::cerr << operation << "<" << std::left << std::setw(11) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
 }
 
+// Divides each two word value in the two-one data set by the following one word value as a 64-bit integer,
+// which goes straight to the 2 word / 1 word division path
+template <typename T, typename Func>
+BOOST_INT128_NO_INLINE void test_one_word_divisor_operation(const std::vector<T>& data_vec, Func op, const char* operation, const char* type)
+{
+    const auto t1 = std::chrono::steady_clock::now();
+    std::uint64_t s = 0; // discard variable
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        for (std::size_t i {}; i < data_vec.size() - 1U; i += 2U)
+        {
+            const auto val1 = data_vec[i];
+            const auto val2 = static_cast<std::uint64_t>(data_vec[i + 1]);
+            s += static_cast<std::uint64_t>((op(val1, val2)));
+        }
+    }
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    std::cerr << operation << "<" << std::left << std::setw(11) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+}
+
+// As above, but the one word value stays in a two word type, so the two word operators
+// have to find the one word divisor path themselves
+template <typename T, typename Func>
+BOOST_INT128_NO_INLINE void test_one_word_value_divisor_operation(const std::vector<T>& data_vec, Func op, const char* operation, const char* type)
+{
+    const auto t1 = std::chrono::steady_clock::now();
+    std::uint64_t s = 0; // discard variable
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        for (std::size_t i {}; i < data_vec.size() - 1U; i += 2U)
+        {
+            const auto val1 = data_vec[i];
+            const auto val2 = static_cast<T>(static_cast<std::uint64_t>(data_vec[i + 1]));
+            s += static_cast<std::uint64_t>((op(val1, val2)));
+        }
+    }
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    std::cerr << operation << "<" << std::left << std::setw(11) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+}
+
 template <typename T>
 BOOST_INT128_NO_INLINE void test_gcd(const std::vector<T>& data_vec, const char* type)
 {
@@ -789,6 +835,58 @@ int main()
         #endif
 
         std::cerr << std::endl;
+
+        #if defined(BOOST_INT128_HAS_INT128) || defined(BOOST_INT128_HAS_MSVC_INTERNAL_I128)
+        test_one_word_divisor_operation(builtin_vector, std::divides<>(), "div u64", "Builtin");
+        #endif
+
+        test_one_word_divisor_operation(library_vector, std::divides<>(), "div u64", "Library");
+        test_one_word_divisor_operation(mp_vector, std::divides<>(), "div u64", "mp::u128");
+
+        #ifdef BOOST_INT128_BENCHMARK_ABSL
+        test_one_word_divisor_operation(absl_vector, std::divides<>(), "div u64", "absl::u128");
+        #endif
+
+        std::cerr << std::endl;
+
+        #if defined(BOOST_INT128_HAS_INT128) || defined(BOOST_INT128_HAS_MSVC_INTERNAL_I128)
+        test_one_word_divisor_operation(builtin_vector, std::modulus<>(), "mod u64", "Builtin");
+        #endif
+
+        test_one_word_divisor_operation(library_vector, std::modulus<>(), "mod u64", "Library");
+        test_one_word_divisor_operation(mp_vector, std::modulus<>(), "mod u64", "mp::u128");
+
+        #ifdef BOOST_INT128_BENCHMARK_ABSL
+        test_one_word_divisor_operation(absl_vector, std::modulus<>(), "mod u64", "absl::u128");
+        #endif
+
+        std::cerr << std::endl;
+
+        #if defined(BOOST_INT128_HAS_INT128) || defined(BOOST_INT128_HAS_MSVC_INTERNAL_I128)
+        test_one_word_value_divisor_operation(builtin_vector, std::divides<>(), "div w64", "Builtin");
+        #endif
+
+        test_one_word_value_divisor_operation(library_vector, std::divides<>(), "div w64", "Library");
+        test_one_word_value_divisor_operation(mp_vector, std::divides<>(), "div w64", "mp::u128");
+
+        #ifdef BOOST_INT128_BENCHMARK_ABSL
+        test_one_word_value_divisor_operation(absl_vector, std::divides<>(), "div w64", "absl::u128");
+        #endif
+
+        std::cerr << std::endl;
+
+        #if defined(BOOST_INT128_HAS_INT128) || defined(BOOST_INT128_HAS_MSVC_INTERNAL_I128)
+        test_one_word_value_divisor_operation(builtin_vector, std::modulus<>(), "mod w64", "Builtin");
+        #endif
+
+        test_one_word_value_divisor_operation(library_vector, std::modulus<>(), "mod w64", "Library");
+        test_one_word_value_divisor_operation(mp_vector, std::modulus<>(), "mod w64", "mp::u128");
+
+        #ifdef BOOST_INT128_BENCHMARK_ABSL
+        test_one_word_value_divisor_operation(absl_vector, std::modulus<>(), "mod w64", "absl::u128");
+        #endif
+
+        std::cerr << std::endl;
     }
     {
         // Two word and one word operations Even = 1, odd = 2
@@ -0,0 +1,10 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128/divider.hpp>
+
+int main()
+{
+    return 0;
+}
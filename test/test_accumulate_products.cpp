@@ -0,0 +1,141 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+
+using namespace boost::int128;
+
+static constexpr std::size_t N {1024U};
+static std::mt19937_64 rng(42);
+
+void test_random()
+{
+    std::uint64_t ua[N] {};
+    std::uint64_t ub[N] {};
+    std::int64_t sa[N] {};
+    std::int64_t sb[N] {};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        // Keep the sums within range so they can be checked against the wrapping operators
+        ua[i] = rng() >> 11U;
+        ub[i] = rng();
+        sa[i] = static_cast<std::int64_t>(rng()) >> 11U;
+        sb[i] = static_cast<std::int64_t>(rng());
+    }
+
+    uint128_t unsigned_expected {};
+    int128_t signed_expected {};
+
+    for (std::size_t n {}; n <= N; ++n)
+    {
+        uint128_t unsigned_sum {};
+        BOOST_TEST(!accumulate_products(&unsigned_sum, ua, ub, n));
+        BOOST_TEST_EQ(unsigned_sum, unsigned_expected);
+
+        int128_t signed_sum {};
+        BOOST_TEST(!accumulate_products(&signed_sum, sa, sb, n));
+        BOOST_TEST_EQ(signed_sum, signed_expected);
+
+        if (n < N)
+        {
+            unsigned_expected += uint128_t{ua[n]} * uint128_t{ub[n]};
+            signed_expected += int128_t{sa[n]} * int128_t{sb[n]};
+        }
+    }
+}
+
+void test_unsigned_limits()
+{
+    constexpr auto max {(std::numeric_limits<std::uint64_t>::max)()};
+    constexpr auto square {uint128_t{max} * uint128_t{max}};
+
+    const std::uint64_t a[] {max, max, max};
+    const std::uint64_t b[] {max, max, 1U};
+
+    uint128_t sum {};
+    BOOST_TEST(!accumulate_products(&sum, a, b, 1U));
+    BOOST_TEST_EQ(sum, square);
+
+    // The wrapped value is still written on overflow
+    BOOST_TEST(accumulate_products(&sum, a, b, 2U));
+    BOOST_TEST_EQ(sum, square + square);
+
+    BOOST_TEST(accumulate_products(&sum, a, b, 3U));
+    BOOST_TEST_EQ(sum, square + square + max);
+
+    // (2^64 - 1)^2 + 2 (2^64 - 1) == 2^128 - 1
+    const std::uint64_t c[] {max, 2U};
+    const std::uint64_t d[] {max, max};
+    BOOST_TEST(!accumulate_products(&sum, c, d, 2U));
+    BOOST_TEST_EQ(sum, (std::numeric_limits<uint128_t>::max)());
+
+    const std::uint64_t e[] {max, 2U, 1U};
+    const std::uint64_t f[] {max, max, 1U};
+    BOOST_TEST(accumulate_products(&sum, e, f, 3U));
+    BOOST_TEST_EQ(sum, 0U);
+}
+
+void test_signed_limits()
+{
+    constexpr auto min {(std::numeric_limits<std::int64_t>::min)()};
+    constexpr auto max {(std::numeric_limits<std::int64_t>::max)()};
+    constexpr auto imax {(std::numeric_limits<int128_t>::max)()};
+    constexpr auto imin {(std::numeric_limits<int128_t>::min)()};
+
+    int128_t sum {};
+
+    // 2^126 + 2^126 == 2^127 overflows
+    const std::int64_t a[] {min, min, min};
+    const std::int64_t b[] {min, min, max};
+    BOOST_TEST(!accumulate_products(&sum, a, b, 1U));
+    BOOST_TEST_EQ(sum, int128_t{min} * int128_t{min});
+    BOOST_TEST(accumulate_products(&sum, a, b, 2U));
+    BOOST_TEST_EQ(sum, imin);
+
+    // The third product brings the exact sum back into range, despite the intermediate overflow
+    BOOST_TEST(!accumulate_products(&sum, a, b, 3U));
+    BOOST_TEST_EQ(sum, static_cast<int128_t>(static_cast<uint128_t>(imin) + static_cast<uint128_t>(int128_t{min} * int128_t{max})));
+
+    // 2^126 + 2^126 - 1 == INT128_MAX
+    const std::int64_t c[] {min, min, -1};
+    const std::int64_t d[] {min, min, 1};
+    BOOST_TEST(!accumulate_products(&sum, c, d, 3U));
+    BOOST_TEST_EQ(sum, imax);
+
+    // (2 * -2^126 + 2^64) - 2^64 == INT128_MIN fits, one more does not
+    const std::int64_t e[] {min, min, min, -1};
+    const std::int64_t f[] {max, max, 2, 1};
+    BOOST_TEST(!accumulate_products(&sum, e, f, 3U));
+    BOOST_TEST_EQ(sum, imin);
+    BOOST_TEST(accumulate_products(&sum, e, f, 4U));
+    BOOST_TEST_EQ(sum, imax);
+}
+
+constexpr int128_t constexpr_sum()
+{
+    constexpr std::int64_t a[] {-3, 5, (std::numeric_limits<std::int64_t>::min)()};
+    constexpr std::int64_t b[] {7, 11, 2};
+
+    int128_t sum {};
+    return accumulate_products(&sum, a, b, 3U) ? int128_t{0} : sum;
+}
+
+void test_constexpr()
+{
+    static_assert(constexpr_sum() == int128_t{-1, UINT64_C(34)}, "Wrong sum");
+}
+
+int main()
+{
+    test_random();
+    test_unsigned_limits();
+    test_signed_limits();
+    test_constexpr();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,186 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/int128/batch.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+
+using namespace boost::int128;
+
+static constexpr std::size_t N {67U};
+static std::mt19937_64 rng(42);
+
+template <typename T>
+T random_value(const std::size_t i)
+{
+    // Mixes values whose low words carry or borrow with values that do not
+    switch (i % 4U)
+    {
+        case 0U:
+            return static_cast<T>(uint128_t{rng(), UINT64_MAX});
+        case 1U:
+            return static_cast<T>(uint128_t{rng(), 0U});
+        case 2U:
+            return static_cast<T>(uint128_t{UINT64_MAX, UINT64_MAX});
+        default:
+            return static_cast<T>(uint128_t{rng(), rng()});
+    }
+}
+
+// References wrap through uint128_t, since int128_t overflow is undefined
+template <typename T>
+T wrapping_add(const T lhs, const T rhs)
+{
+    return static_cast<T>(static_cast<uint128_t>(lhs) + static_cast<uint128_t>(rhs));
+}
+
+template <typename T>
+T wrapping_sub(const T lhs, const T rhs)
+{
+    return static_cast<T>(static_cast<uint128_t>(lhs) - static_cast<uint128_t>(rhs));
+}
+
+template <typename T>
+void test_arrays()
+{
+    T a[N] {};
+    T b[N] {};
+    T out[N] {};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        a[i] = random_value<T>(i);
+        b[i] = random_value<T>(i * 3U + 1U);
+    }
+
+    // Every length up to N covers both the vector loop and the scalar tail
+    for (std::size_t n {}; n <= N; ++n)
+    {
+        add(a, b, out, n);
+        for (std::size_t i {}; i < n; ++i)
+        {
+            BOOST_TEST_EQ(out[i], wrapping_add(a[i], b[i]));
+        }
+
+        sub(a, b, out, n);
+        for (std::size_t i {}; i < n; ++i)
+        {
+            BOOST_TEST_EQ(out[i], wrapping_sub(a[i], b[i]));
+        }
+
+        add_scalar(a, b[n % N], out, n);
+        for (std::size_t i {}; i < n; ++i)
+        {
+            BOOST_TEST_EQ(out[i], wrapping_add(a[i], b[n % N]));
+        }
+    }
+
+    // Elements past n are left untouched
+    T untouched[N] {};
+    add(a, b, untouched, N / 2U);
+    for (std::size_t i {N / 2U}; i < N; ++i)
+    {
+        BOOST_TEST_EQ(untouched[i], T{0});
+    }
+}
+
+template <typename T>
+void test_in_place()
+{
+    T a[N] {};
+    T b[N] {};
+    T expected[N] {};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        a[i] = random_value<T>(i + 1U);
+        b[i] = random_value<T>(i + 2U);
+        expected[i] = wrapping_add(a[i], T{5});
+    }
+
+    sub(a, b, a, N);
+    add(b, a, a, N);
+    add_scalar(a, T{5}, a, N);
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST_EQ(a[i], expected[i]);
+    }
+}
+
+void test_limits()
+{
+    constexpr auto umax {(std::numeric_limits<uint128_t>::max)()};
+    constexpr auto imax {(std::numeric_limits<int128_t>::max)()};
+    constexpr auto imin {(std::numeric_limits<int128_t>::min)()};
+
+    const uint128_t ua[] {umax, uint128_t{UINT64_MAX}, uint128_t{0U}, uint128_t{1U, 0U}, umax};
+    const uint128_t ub[] {uint128_t{1U}, uint128_t{1U}, uint128_t{1U}, uint128_t{1U}, umax};
+    uint128_t uout[5] {};
+
+    add(ua, ub, uout, 5U);
+    BOOST_TEST_EQ(uout[0], 0U);
+    BOOST_TEST_EQ(uout[1], uint128_t(1U, 0U));
+    BOOST_TEST_EQ(uout[2], 1U);
+    BOOST_TEST_EQ(uout[3], uint128_t(1U, 1U));
+    BOOST_TEST_EQ(uout[4], umax - 1U);
+
+    sub(ub, ua, uout, 5U);
+    BOOST_TEST_EQ(uout[0], 2U);
+    BOOST_TEST_EQ(uout[1], uint128_t(UINT64_MAX, 2U));
+    BOOST_TEST_EQ(uout[2], 1U);
+    BOOST_TEST_EQ(uout[3], uint128_t(UINT64_MAX, 1U));
+    BOOST_TEST_EQ(uout[4], 0U);
+
+    const int128_t ia[] {imax, imin, int128_t{-1}, int128_t{0}};
+    const int128_t ib[] {int128_t{1}, int128_t{-1}, int128_t{1}, int128_t{-1}};
+    int128_t iout[4] {};
+
+    add(ia, ib, iout, 4U);
+    BOOST_TEST_EQ(iout[0], imin);
+    BOOST_TEST_EQ(iout[1], imax);
+    BOOST_TEST_EQ(iout[2], 0);
+    BOOST_TEST_EQ(iout[3], -1);
+
+    sub(ia, ib, iout, 4U);
+    BOOST_TEST_EQ(iout[0], imax - 1);
+    BOOST_TEST_EQ(iout[1], imin + 1);
+    BOOST_TEST_EQ(iout[2], -2);
+    BOOST_TEST_EQ(iout[3], 1);
+
+    add_scalar(ia, int128_t{-1}, iout, 4U);
+    BOOST_TEST_EQ(iout[0], imax - 1);
+    BOOST_TEST_EQ(iout[1], imax);
+    BOOST_TEST_EQ(iout[2], -2);
+    BOOST_TEST_EQ(iout[3], -1);
+}
+
+constexpr uint128_t constexpr_sum()
+{
+    uint128_t a[] {uint128_t{UINT64_MAX}, uint128_t{2U}, uint128_t{3U}};
+    uint128_t b[] {uint128_t{1U}, uint128_t{5U}, uint128_t{7U}};
+    add(a, b, a, 3U);
+    sub(a, b, b, 3U);
+    add_scalar(a, uint128_t{1U}, a, 3U);
+    return a[0] + a[1] + a[2] + b[0] + b[1] + b[2];
+}
+
+void test_constexpr()
+{
+    static_assert(constexpr_sum() == uint128_t{1U, 0U} + 1U + 8U + 11U + uint128_t{UINT64_MAX} + 2U + 3U, "Wrong sum");
+}
+
+int main()
+{
+    test_arrays<uint128_t>();
+    test_arrays<int128_t>();
+    test_in_place<uint128_t>();
+    test_in_place<int128_t>();
+    test_limits();
+    test_constexpr();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,147 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+
+using namespace boost::int128;
+
+static constexpr std::size_t N {1024U};
+static std::mt19937_64 rng(42);
+static std::uniform_int_distribution<std::uint64_t> dist(0, UINT64_MAX);
+
+// Random bit patterns with widths spread over the whole range, so that sums and products land on both sides of the limit
+uint128_t random_value(const std::size_t i)
+{
+    const auto shift {static_cast<unsigned>(i % 128U)};
+    return uint128_t{dist(rng), dist(rng)} >> shift;
+}
+
+void check_unsigned(const uint128_t a, const uint128_t b)
+{
+    uint128_t res {};
+
+    BOOST_TEST_EQ(ckd_add(&res, a, b), add_sat(a, b) != a + b);
+    BOOST_TEST_EQ(res, a + b);
+
+    BOOST_TEST_EQ(ckd_sub(&res, a, b), a < b);
+    BOOST_TEST_EQ(res, a - b);
+
+    const auto wide {mul_wide(a, b)};
+    BOOST_TEST_EQ(ckd_mul(&res, a, b), wide.high != 0U);
+    BOOST_TEST_EQ(res, wide.low);
+
+    // The portable path, whichever one ckd_mul uses on this platform
+    BOOST_TEST_EQ(detail::umul_overflow(&res, a, b), wide.high != 0U);
+    BOOST_TEST_EQ(res, wide.low);
+}
+
+void check_signed(const int128_t a, const int128_t b)
+{
+    int128_t res {};
+
+    BOOST_TEST_EQ(ckd_add(&res, a, b), add_sat(a, b) != static_cast<int128_t>(static_cast<uint128_t>(a) + static_cast<uint128_t>(b)));
+    BOOST_TEST_EQ(res, static_cast<int128_t>(static_cast<uint128_t>(a) + static_cast<uint128_t>(b)));
+
+    BOOST_TEST_EQ(ckd_sub(&res, a, b), sub_sat(a, b) != static_cast<int128_t>(static_cast<uint128_t>(a) - static_cast<uint128_t>(b)));
+    BOOST_TEST_EQ(res, static_cast<int128_t>(static_cast<uint128_t>(a) - static_cast<uint128_t>(b)));
+
+    // The product fits exactly when the high half is the sign extension of the low half
+    const auto wide {mul_wide(a, b)};
+    const auto sign_extension {static_cast<int128_t>(wide.low) < 0 ? int128_t{-1} : int128_t{0}};
+    BOOST_TEST_EQ(ckd_mul(&res, a, b), wide.high != sign_extension);
+    BOOST_TEST_EQ(res, static_cast<int128_t>(wide.low));
+}
+
+void test_random()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto a {random_value(i)};
+        const auto b {random_value(i * 7U + 3U)};
+
+        check_unsigned(a, b);
+        check_unsigned(b, a);
+
+        const auto sa {static_cast<int128_t>(a)};
+        const auto sb {static_cast<int128_t>(b)};
+        check_signed(sa, sb);
+        check_signed(-sa, sb);
+        check_signed(sa >> 1, -(sb >> 1));
+    }
+}
+
+void test_limits()
+{
+    constexpr auto umax {(std::numeric_limits<uint128_t>::max)()};
+    constexpr auto imax {(std::numeric_limits<int128_t>::max)()};
+    constexpr auto imin {(std::numeric_limits<int128_t>::min)()};
+
+    const uint128_t unsigned_values[] {uint128_t{0U}, uint128_t{1U}, uint128_t{2U}, uint128_t{UINT64_MAX},
+                                       uint128_t{1U, 0U}, uint128_t{1U, 1U}, umax / 2U, umax / 2U + 1U, umax - 1U, umax};
+
+    for (const auto& a : unsigned_values)
+    {
+        for (const auto& b : unsigned_values)
+        {
+            check_unsigned(a, b);
+        }
+    }
+
+    const int128_t signed_values[] {int128_t{0}, int128_t{1}, int128_t{-1}, int128_t{2}, int128_t{-2},
+                                    int128_t{INT64_MAX}, int128_t{INT64_MIN}, int128_t{1, 0}, int128_t{-1, 0},
+                                    imax / 2, int128_t{INT64_MIN / 2, 0}, imax - 1, imax, imin + 1, imin};
+
+    for (const auto& a : signed_values)
+    {
+        for (const auto& b : signed_values)
+        {
+            check_signed(a, b);
+        }
+    }
+
+    int128_t res {};
+    BOOST_TEST(ckd_mul(&res, imin, int128_t{-1}));
+    BOOST_TEST_EQ(res, imin);
+    BOOST_TEST(!ckd_mul(&res, imin, int128_t{1}));
+    BOOST_TEST(!ckd_mul(&res, int128_t{INT64_MIN / 2, 0}, int128_t{2}));
+    BOOST_TEST_EQ(res, imin);
+    BOOST_TEST(ckd_mul(&res, imax / 2 + 1, int128_t{2}));
+    BOOST_TEST(!ckd_sub(&res, int128_t{-1}, imax));
+    BOOST_TEST_EQ(res, imin);
+    BOOST_TEST(ckd_sub(&res, int128_t{-2}, imax));
+    BOOST_TEST_EQ(res, imax);
+}
+
+constexpr bool add_overflows(const uint128_t a, const uint128_t b)
+{
+    uint128_t res {};
+    return ckd_add(&res, a, b);
+}
+
+constexpr int128_t checked_product(const int128_t a, const int128_t b)
+{
+    int128_t res {};
+    return ckd_mul(&res, a, b) ? int128_t{0} : res;
+}
+
+void test_constexpr()
+{
+    constexpr auto umax {(std::numeric_limits<uint128_t>::max)()};
+    static_assert(add_overflows(umax, uint128_t{1U}), "Wrong overflow");
+    static_assert(!add_overflows(umax, uint128_t{0U}), "Wrong overflow");
+    static_assert(checked_product(int128_t{-3}, int128_t{1, 0}) == int128_t{-3, 0}, "Wrong product");
+    static_assert(checked_product(int128_t{INT64_MAX, 0}, int128_t{4}) == 0, "Wrong overflow");
+}
+
+int main()
+{
+    test_random();
+    test_limits();
+    test_constexpr();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,194 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/int128/soa_vector.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <utility>
+
+using namespace boost::int128;
+
+static constexpr std::size_t N {203U};
+static constexpr std::size_t words {(N + 63U) / 64U};
+static std::mt19937_64 rng(42);
+
+template <typename T>
+T random_value()
+{
+    // Few distinct words means many comparisons are decided by the low words, and many are equal
+    constexpr std::uint64_t values[] {0U, 1U, 2U, UINT64_MAX, UINT64_C(0x8000000000000000), UINT64_C(0x7FFFFFFFFFFFFFFF)};
+    return static_cast<T>(uint128_t{values[rng() % 6U], values[rng() % 6U]});
+}
+
+bool test_bit(const std::uint64_t* mask, const std::size_t i)
+{
+    return ((mask[i / 64U] >> (i % 64U)) & 1U) != 0U;
+}
+
+template <typename T>
+void check_mask(const std::uint64_t* mask, const std::size_t n, const T* a, const T low, const T high, const int op)
+{
+    for (std::size_t i {}; i < n; ++i)
+    {
+        const bool expected {op == 0 ? a[i] == low : op == 1 ? a[i] > low : low <= a[i] && a[i] <= high};
+        BOOST_TEST_EQ(test_bit(mask, i), expected);
+    }
+
+    // Bits past n are cleared
+    if (n % 64U != 0U)
+    {
+        BOOST_TEST_EQ(mask[n / 64U] >> (n % 64U), 0U);
+    }
+}
+
+template <typename T>
+void test_arrays()
+{
+    T a[N] {};
+    for (auto& value : a)
+    {
+        value = random_value<T>();
+    }
+
+    soa_vector<T> soa;
+
+    // Every length up to N covers whole mask words, the vector loop and the scalar tail
+    for (std::size_t n {}; n <= N; ++n)
+    {
+        const auto value {a[n % N]};
+        auto low {random_value<T>()};
+        auto high {random_value<T>()};
+        if (high < low)
+        {
+            std::swap(low, high);
+        }
+
+        std::uint64_t mask[words] {};
+        for (auto& word : mask)
+        {
+            word = UINT64_MAX;
+        }
+
+        compare_eq(a, value, mask, n);
+        check_mask(mask, n, a, value, value, 0);
+        compare_eq(soa, value, mask);
+        check_mask(mask, n, a, value, value, 0);
+
+        compare_gt(a, value, mask, n);
+        check_mask(mask, n, a, value, value, 1);
+        compare_gt(soa, value, mask);
+        check_mask(mask, n, a, value, value, 1);
+
+        compare_between(a, low, high, mask, n);
+        check_mask(mask, n, a, low, high, 2);
+        compare_between(soa, low, high, mask);
+        check_mask(mask, n, a, low, high, 2);
+
+        std::size_t indices[N] {};
+        const auto count {select_indices(mask, n, indices)};
+        std::size_t expected_count {};
+        for (std::size_t i {}; i < n; ++i)
+        {
+            if (low <= a[i] && a[i] <= high)
+            {
+                BOOST_TEST_EQ(indices[expected_count], i);
+                ++expected_count;
+            }
+        }
+        BOOST_TEST_EQ(count, expected_count);
+
+        if (n < N)
+        {
+            soa.push_back(a[n]);
+        }
+    }
+}
+
+template <typename T>
+void test_limits()
+{
+    constexpr auto max {(std::numeric_limits<T>::max)()};
+    constexpr auto min {(std::numeric_limits<T>::min)()};
+
+    T a[N] {};
+    for (std::size_t i {}; i < N; ++i)
+    {
+        a[i] = i % 3U == 0U ? max : i % 3U == 1U ? min : T{2};
+    }
+
+    std::uint64_t mask[words] {};
+
+    compare_gt(a, max, mask, N);
+    BOOST_TEST_EQ(select_indices(mask, N, static_cast<std::size_t*>(nullptr)), 0U);
+
+    compare_gt(a, min, mask, N);
+    std::size_t indices[N] {};
+    BOOST_TEST_EQ(select_indices(mask, N, indices), N - (N + 1U) / 3U);
+
+    compare_between(a, min, max, mask, N);
+    BOOST_TEST_EQ(select_indices(mask, N, indices), N);
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST_EQ(indices[i], i);
+    }
+
+    // An empty range when the bounds are reversed
+    compare_between(a, max, min, mask, N);
+    BOOST_TEST_EQ(select_indices(mask, N, indices), 0U);
+
+    compare_between(a, T{2}, T{2}, mask, N);
+    BOOST_TEST_EQ(select_indices(mask, N, indices), N / 3U);
+    BOOST_TEST_EQ(indices[0], 2U);
+}
+
+void test_signed()
+{
+    // Negative values are smaller than positive ones despite their larger unsigned high words
+    int128_t a[64] {};
+    for (std::size_t i {}; i < 64U; ++i)
+    {
+        a[i] = i % 2U == 0U ? -static_cast<int128_t>(i) - 1 : static_cast<int128_t>(uint128_t{i, UINT64_MAX});
+    }
+
+    std::uint64_t mask {};
+    compare_gt(a, int128_t{-1}, &mask, 64U);
+    BOOST_TEST_EQ(mask, UINT64_C(0xAAAAAAAAAAAAAAAA));
+
+    compare_between(a, int128_t{-10}, int128_t{UINT64_MAX}, &mask, 64U);
+    BOOST_TEST_EQ(mask, UINT64_C(0x155));
+}
+
+constexpr std::size_t constexpr_filter()
+{
+    const uint128_t a[] {uint128_t{1U, 0U}, uint128_t{5U}, uint128_t{UINT64_MAX}, uint128_t{5U}};
+    std::uint64_t mask {};
+    std::size_t indices[4] {};
+
+    compare_eq(a, uint128_t{5U}, &mask, 4U);
+    const auto eq {select_indices(&mask, 4U, indices)};
+    compare_gt(a, uint128_t{5U}, &mask, 4U);
+    const auto gt {select_indices(&mask, 4U, indices)};
+    compare_between(a, uint128_t{5U}, uint128_t{UINT64_MAX}, &mask, 4U);
+
+    return eq * 100U + gt * 10U + select_indices(&mask, 4U, indices) + indices[2] * 1000U;
+}
+
+void test_constexpr()
+{
+    static_assert(constexpr_filter() == 3000U + 200U + 20U + 3U, "Wrong filter");
+}
+
+int main()
+{
+    test_arrays<uint128_t>();
+    test_arrays<int128_t>();
+    test_limits<uint128_t>();
+    test_limits<int128_t>();
+    test_signed();
+    test_constexpr();
+
+    return boost::report_errors();
+}
@@ -5,6 +5,7 @@
 #include <boost/int128.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include <random>
+#include <limits>
 
 using namespace boost::int128;
 
@@ -122,6 +123,117 @@ void test_signed_div()
 #  pragma warning(pop)
 #endif
 
+void check_one_word_div(const uint128_t lhs, const std::uint64_t rhs)
+{
+    const auto q {lhs / rhs};
+    const auto r {lhs % rhs};
+
+    // Verify against the definition of division rather than another division path
+    BOOST_TEST(r < rhs);
+    BOOST_TEST_EQ(q * rhs + r, lhs);
+
+    // The operators filter out lhs < rhs before reaching the division routines
+    if (lhs >= rhs)
+    {
+        uint128_t quotient {};
+        uint128_t remainder {};
+        detail::one_word_div(lhs, rhs, quotient, remainder);
+        BOOST_TEST_EQ(quotient, q);
+        BOOST_TEST_EQ(remainder, r);
+
+        // knuth_div has its own fast path for divisors that fit in one word
+        remainder = 0U;
+        BOOST_TEST_EQ(detail::knuth_div(lhs, uint128_t{rhs}), q);
+        BOOST_TEST_EQ(detail::knuth_div(lhs, uint128_t{rhs}, remainder), q);
+        BOOST_TEST_EQ(remainder, r);
+    }
+}
+
+void test_one_word_div()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const uint128_t lhs {dist(rng), dist(rng)};
+
+        // Exercise every normalization shift of the divisor
+        for (int shift {}; shift < 32; ++shift)
+        {
+            const auto rhs {(dist(rng) | (UINT64_C(1) << 63U)) >> shift};
+            check_one_word_div(lhs, rhs);
+        }
+    }
+
+    constexpr std::uint64_t divisors[] {
+        UINT64_C(0x100000000), UINT64_C(0x100000001), UINT64_C(0x8000000000000000), UINT64_C(0x8000000000000001),
+        UINT64_C(10000000000000000000), UINT64_MAX, UINT64_MAX - 1U
+    };
+
+    constexpr uint128_t numerators[] {
+        uint128_t{0U, 0U}, uint128_t{0U, UINT64_MAX}, uint128_t{1U, 0U}, uint128_t{UINT64_MAX, 0U},
+        uint128_t{UINT64_MAX, UINT64_MAX}, uint128_t{UINT64_MAX - 1U, UINT64_MAX}, uint128_t{0x8000000000000000U, 0U}
+    };
+
+    for (const auto rhs : divisors)
+    {
+        for (const auto& lhs : numerators)
+        {
+            check_one_word_div(lhs, rhs);
+        }
+    }
+
+    constexpr auto q {(std::numeric_limits<uint128_t>::max)() / UINT64_C(10000000000000000000)};
+    constexpr auto r {(std::numeric_limits<uint128_t>::max)() % UINT64_C(10000000000000000000)};
+    static_assert(q == uint128_t{UINT64_C(1), UINT64_C(15581492618384294730)}, "Wrong quotient");
+    static_assert(r == uint128_t{UINT64_C(3374607431768211455)}, "Wrong remainder");
+}
+
+void check_two_word_div(const uint128_t lhs, const uint128_t rhs)
+{
+    uint128_t remainder {};
+    const auto q {detail::knuth_div(lhs, rhs, remainder)};
+
+    BOOST_TEST(remainder < rhs);
+    BOOST_TEST_EQ(q * rhs + remainder, lhs);
+    BOOST_TEST_EQ(detail::knuth_div(lhs, rhs), q);
+}
+
+void test_two_word_div()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const uint128_t lhs {dist(rng), dist(rng)};
+
+        // Exercise every normalization shift of the divisor
+        for (int shift {}; shift < 64; ++shift)
+        {
+            const uint128_t rhs {(dist(rng) | (UINT64_C(1) << 63U)) >> shift, dist(rng)};
+            check_two_word_div(lhs > rhs ? lhs : rhs, lhs > rhs ? rhs : lhs);
+        }
+    }
+
+    // Values where the quotient estimate needs correcting
+    constexpr uint128_t divisors[] {
+        uint128_t{1U, 0U}, uint128_t{1U, UINT64_MAX}, uint128_t{0x8000000000000000U, 0U},
+        uint128_t{0x8000000000000000U, UINT64_MAX}, uint128_t{UINT64_MAX, UINT64_MAX}, uint128_t{0x7FFFFFFFFFFFFFFFU, UINT64_MAX}
+    };
+
+    for (const auto& rhs : divisors)
+    {
+        for (const auto& lhs : divisors)
+        {
+            if (lhs >= rhs)
+            {
+                check_two_word_div(lhs, rhs);
+            }
+        }
+    }
+
+    constexpr auto max_value {(std::numeric_limits<uint128_t>::max)()};
+    static_assert(detail::knuth_div(max_value, uint128_t{1U, 3U}) == uint128_t{UINT64_C(18446744073709551613)}, "Wrong quotient");
+    static_assert(detail::knuth_div(max_value, uint128_t{UINT64_C(0x8000000000000000), 1U}) == 1U, "Wrong quotient");
+    static_assert(detail::knuth_div(max_value, uint128_t{12345U, 678U}) == uint128_t{UINT64_C(1494268454735484)}, "Wrong quotient");
+}
+
 int main()
 {
     test_unsigned_div<0>();
@@ -134,5 +246,8 @@ int main()
     test_signed_div<2>();
     test_signed_div<3>();
 
+    test_one_word_div();
+    test_two_word_div();
+
     return boost::report_errors();
 }
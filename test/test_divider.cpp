@@ -0,0 +1,362 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/int128/divider.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+
+using namespace boost::int128;
+
+static constexpr std::size_t N {1024U};
+static std::mt19937_64 rng(42);
+static std::uniform_int_distribution<std::uint64_t> dist(0, UINT64_MAX);
+static std::uniform_int_distribution<std::uint32_t> dist32(1, UINT32_MAX);
+
+void check_unsigned(const uint128_t lhs, const divider<uint128_t>& d)
+{
+    const auto rhs {d.divisor()};
+
+    BOOST_TEST_EQ(lhs / d, lhs / rhs);
+    BOOST_TEST_EQ(lhs % d, lhs % rhs);
+
+    const auto res {div(lhs, d)};
+    BOOST_TEST_EQ(res.quot, lhs / rhs);
+    BOOST_TEST_EQ(res.rem, lhs % rhs);
+
+    auto q {lhs};
+    q /= d;
+    BOOST_TEST_EQ(q, lhs / rhs);
+
+    auto r {lhs};
+    r %= d;
+    BOOST_TEST_EQ(r, lhs % rhs);
+}
+
+template <typename DivisorType>
+void test_unsigned_random_divisors()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        DivisorType rhs {};
+        BOOST_INT128_IF_CONSTEXPR (std::is_same<DivisorType, std::uint32_t>::value)
+        {
+            rhs = static_cast<DivisorType>(dist32(rng));
+        }
+        else BOOST_INT128_IF_CONSTEXPR (std::is_same<DivisorType, std::uint64_t>::value)
+        {
+            rhs = static_cast<DivisorType>(dist(rng));
+        }
+        else
+        {
+            rhs = static_cast<DivisorType>(uint128_t{dist(rng), dist(rng)});
+        }
+
+        const divider<uint128_t> d {rhs};
+
+        for (std::size_t j {}; j < 16U; ++j)
+        {
+            check_unsigned(uint128_t{dist(rng), dist(rng)}, d);
+            check_unsigned(uint128_t{dist(rng)}, d);
+        }
+    }
+}
+
+void test_unsigned_edge_cases()
+{
+    constexpr auto max_value {(std::numeric_limits<uint128_t>::max)()};
+
+    const uint128_t divisors[] {
+        uint128_t{1U}, uint128_t{2U}, uint128_t{3U}, uint128_t{5U}, uint128_t{7U}, uint128_t{10U},
+        uint128_t{641U}, uint128_t{UINT32_MAX}, uint128_t{UINT64_MAX}, uint128_t{1U, 0U}, uint128_t{1U, 1U},
+        uint128_t{0U, UINT64_C(10000000000000000000)}, uint128_t{UINT64_MAX, UINT64_MAX - 1U},
+        max_value, max_value >> 1U, (max_value >> 1U) + 1U, (max_value >> 1U) + 2U
+    };
+
+    const uint128_t numerators[] {
+        uint128_t{0U}, uint128_t{1U}, uint128_t{2U}, uint128_t{UINT64_MAX}, uint128_t{1U, 0U},
+        max_value, max_value - 1U, max_value >> 1U, (max_value >> 1U) + 1U
+    };
+
+    for (const auto& rhs : divisors)
+    {
+        const divider<uint128_t> d {rhs};
+        BOOST_TEST_EQ(d.divisor(), rhs);
+
+        for (const auto& lhs : numerators)
+        {
+            check_unsigned(lhs, d);
+            check_unsigned(lhs * 3U + 1U, d);
+            check_unsigned(rhs * 2U, d);
+            check_unsigned(rhs * 2U - 1U, d);
+        }
+    }
+
+    // Every power of two takes the shift path
+    for (int i {}; i < 128; ++i)
+    {
+        const divider<uint128_t> d {uint128_t{0U, 1U} << i};
+        check_unsigned(max_value, d);
+        check_unsigned(uint128_t{dist(rng), dist(rng)}, d);
+    }
+
+    // One word divisors of every length, which take the reciprocal path without a native 64x64 multiply
+    for (int i {1}; i < 64; ++i)
+    {
+        const divider<uint128_t> d {(uint128_t{0U, 1U} << i) + 1U};
+        check_unsigned(max_value, d);
+        check_unsigned(uint128_t{dist(rng), dist(rng)}, d);
+    }
+
+    // Division by zero matches the behavior of the operators
+    const divider<uint128_t> zero {uint128_t{0U}};
+    BOOST_TEST_EQ(max_value / zero, 0U);
+    BOOST_TEST_EQ(max_value % zero, 0U);
+    BOOST_TEST_EQ(div(max_value, zero).quot, 0U);
+    BOOST_TEST_EQ(div(max_value, zero).rem, 0U);
+
+    // The default divider divides by one
+    const divider<uint128_t> one {};
+    BOOST_TEST_EQ(max_value / one, max_value);
+    BOOST_TEST_EQ(max_value % one, 0U);
+}
+
+void test_unsigned_constexpr()
+{
+    constexpr divider<uint128_t> d {UINT64_C(10000000000000000000)};
+    constexpr auto value {(std::numeric_limits<uint128_t>::max)()};
+    constexpr auto q {value / d};
+    constexpr auto r {value % d};
+
+    static_assert(q == uint128_t{UINT64_C(1), UINT64_C(15581492618384294730)}, "Wrong quotient");
+    static_assert(r == uint128_t{UINT64_C(3374607431768211455)}, "Wrong remainder");
+
+    BOOST_TEST_EQ(q, value / UINT64_C(10000000000000000000));
+    BOOST_TEST_EQ(r, value % UINT64_C(10000000000000000000));
+}
+
+void check_signed(const int128_t lhs, const divider<int128_t>& d)
+{
+    // The operators do not handle INT128_MIN as a numerator so it is tested separately
+    if (lhs == (std::numeric_limits<int128_t>::min)())
+    {
+        return;
+    }
+
+    const auto rhs {d.divisor()};
+
+    BOOST_TEST_EQ(lhs / d, lhs / rhs);
+    BOOST_TEST_EQ(lhs % d, lhs % rhs);
+
+    const auto res {div(lhs, d)};
+    BOOST_TEST_EQ(res.quot, lhs / rhs);
+    BOOST_TEST_EQ(res.rem, lhs % rhs);
+
+    auto q {lhs};
+    q /= d;
+    BOOST_TEST_EQ(q, lhs / rhs);
+
+    auto r {lhs};
+    r %= d;
+    BOOST_TEST_EQ(r, lhs % rhs);
+
+    // Floored division rounds towards negative infinity
+    // quot * rhs may itself be out of range, so the identity is checked modulo 2^128
+    const auto floor_res {d.floor_divide(lhs)};
+    BOOST_TEST_EQ(static_cast<uint128_t>(floor_res.quot) * static_cast<uint128_t>(rhs) + static_cast<uint128_t>(floor_res.rem), static_cast<uint128_t>(lhs));
+    BOOST_TEST(floor_res.rem == 0 || ((floor_res.rem < 0) == (rhs < 0)));
+    BOOST_TEST(abs(floor_res.rem) < abs(rhs));
+
+    // Euclidean division always has a non-negative remainder
+    const auto euclid_res {d.euclid_divide(lhs)};
+    BOOST_TEST_EQ(static_cast<uint128_t>(euclid_res.quot) * static_cast<uint128_t>(rhs) + static_cast<uint128_t>(euclid_res.rem), static_cast<uint128_t>(lhs));
+    BOOST_TEST(euclid_res.rem >= 0);
+    BOOST_TEST(static_cast<uint128_t>(euclid_res.rem) < static_cast<uint128_t>(abs(rhs)));
+}
+
+template <typename DivisorType>
+void test_signed_random_divisors()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        DivisorType rhs {};
+        BOOST_INT128_IF_CONSTEXPR (std::is_same<DivisorType, std::int32_t>::value)
+        {
+            rhs = static_cast<DivisorType>(dist32(rng));
+        }
+        else BOOST_INT128_IF_CONSTEXPR (std::is_same<DivisorType, std::int64_t>::value)
+        {
+            rhs = static_cast<DivisorType>(dist(rng));
+        }
+        else
+        {
+            rhs = static_cast<DivisorType>(int128_t{static_cast<std::int64_t>(dist(rng)), dist(rng)});
+        }
+
+        if (rhs == 0)
+        {
+            continue;
+        }
+
+        const divider<int128_t> d {rhs};
+
+        for (std::size_t j {}; j < 16U; ++j)
+        {
+            const int128_t lhs {static_cast<std::int64_t>(dist(rng)), dist(rng)};
+
+            check_signed(lhs, d);
+
+            check_signed(int128_t{static_cast<std::int64_t>(dist(rng))}, d);
+        }
+    }
+}
+
+void test_signed_edge_cases()
+{
+    constexpr auto max_value {(std::numeric_limits<int128_t>::max)()};
+    constexpr auto min_value {(std::numeric_limits<int128_t>::min)()};
+
+    const int128_t divisors[] {
+        int128_t{1}, int128_t{2}, int128_t{3}, int128_t{5}, int128_t{7}, int128_t{10}, int128_t{641},
+        int128_t{INT32_MAX}, int128_t{INT64_MAX}, int128_t{1, 0U}, int128_t{1, 1U},
+        max_value, max_value - 1, max_value / 2, (max_value / 2) + 1, (max_value / 2) + 2
+    };
+
+    const int128_t numerators[] {
+        int128_t{0}, int128_t{1}, int128_t{2}, int128_t{INT64_MAX}, int128_t{1, 0U},
+        max_value, max_value - 1, max_value / 2, min_value + 1, min_value / 2
+    };
+
+    for (const auto& divisor : divisors)
+    {
+        for (const auto& rhs : {divisor, -divisor})
+        {
+            const divider<int128_t> d {rhs};
+            BOOST_TEST_EQ(d.divisor(), rhs);
+
+            for (const auto& lhs : numerators)
+            {
+                check_signed(lhs, d);
+                check_signed(-lhs, d);
+                check_signed(lhs / 3 + 1, d);
+                check_signed(-(lhs / 3 + 1), d);
+            }
+
+            check_signed(rhs, d);
+            check_signed(-rhs, d);
+            check_signed(rhs - 1, d);
+            check_signed(rhs + 1, d);
+        }
+    }
+
+    // Every power of two takes the shift path
+    for (int i {}; i < 127; ++i)
+    {
+        const auto rhs {int128_t{0, 1U} << i};
+
+        for (const auto& d : {divider<int128_t>{rhs}, divider<int128_t>{-rhs}})
+        {
+            check_signed(max_value, d);
+            check_signed(min_value + 1, d);
+            check_signed(int128_t{static_cast<std::int64_t>(dist(rng)), dist(rng)}, d);
+        }
+    }
+
+    // INT128_MIN has no positive counterpart so it is checked directly
+    const divider<int128_t> min_divider {min_value};
+    BOOST_TEST_EQ(min_value / min_divider, 1);
+    BOOST_TEST_EQ(min_value % min_divider, 0);
+    BOOST_TEST_EQ(max_value / min_divider, 0);
+    BOOST_TEST_EQ(max_value % min_divider, max_value);
+    BOOST_TEST_EQ((min_value + 1) / min_divider, 0);
+
+    BOOST_TEST_EQ(min_value / divider<int128_t>{3}, -(max_value / 3));
+    BOOST_TEST_EQ(min_value % divider<int128_t>{3}, -2);
+    BOOST_TEST_EQ(min_value / divider<int128_t>{-2}, (int128_t{0, 1U} << 126));
+    BOOST_TEST_EQ(min_value % divider<int128_t>{-2}, 0);
+
+    // The only overflowing quotient wraps like the underlying two's complement arithmetic
+    BOOST_TEST_EQ(min_value / divider<int128_t>{-1}, min_value);
+    BOOST_TEST_EQ(min_value % divider<int128_t>{-1}, 0);
+
+    // Division by zero matches the behavior of the operators
+    const divider<int128_t> zero {int128_t{0}};
+    BOOST_TEST_EQ(max_value / zero, 0);
+    BOOST_TEST_EQ(max_value % zero, 0);
+    BOOST_TEST_EQ(div(min_value, zero).quot, 0);
+    BOOST_TEST_EQ(div(min_value, zero).rem, 0);
+
+    // The default divider divides by one
+    const divider<int128_t> one {};
+    BOOST_TEST_EQ(min_value / one, min_value);
+    BOOST_TEST_EQ(min_value % one, 0);
+}
+
+void test_signed_rounding()
+{
+    const divider<int128_t> pos {7};
+    const divider<int128_t> neg {-7};
+
+    BOOST_TEST_EQ(pos.divide(-20).quot, -2);
+    BOOST_TEST_EQ(pos.divide(-20).rem, -6);
+    BOOST_TEST_EQ(pos.floor_divide(-20).quot, -3);
+    BOOST_TEST_EQ(pos.floor_divide(-20).rem, 1);
+    BOOST_TEST_EQ(pos.euclid_divide(-20).quot, -3);
+    BOOST_TEST_EQ(pos.euclid_divide(-20).rem, 1);
+
+    BOOST_TEST_EQ(neg.divide(20).quot, -2);
+    BOOST_TEST_EQ(neg.divide(20).rem, 6);
+    BOOST_TEST_EQ(neg.floor_divide(20).quot, -3);
+    BOOST_TEST_EQ(neg.floor_divide(20).rem, -1);
+    BOOST_TEST_EQ(neg.euclid_divide(20).quot, -2);
+    BOOST_TEST_EQ(neg.euclid_divide(20).rem, 6);
+
+    BOOST_TEST_EQ(neg.divide(-20).quot, 2);
+    BOOST_TEST_EQ(neg.divide(-20).rem, -6);
+    BOOST_TEST_EQ(neg.floor_divide(-20).quot, 2);
+    BOOST_TEST_EQ(neg.floor_divide(-20).rem, -6);
+    BOOST_TEST_EQ(neg.euclid_divide(-20).quot, 3);
+    BOOST_TEST_EQ(neg.euclid_divide(-20).rem, 1);
+
+    // Exact division is the same in every mode
+    BOOST_TEST_EQ(neg.floor_divide(-21).quot, 3);
+    BOOST_TEST_EQ(neg.euclid_divide(-21).quot, 3);
+    BOOST_TEST_EQ(pos.floor_divide(-21).rem, 0);
+    BOOST_TEST_EQ(pos.euclid_divide(-21).rem, 0);
+}
+
+void test_signed_constexpr()
+{
+    constexpr divider<int128_t> d {-INT64_C(1000000000000000000)};
+    constexpr auto value {(std::numeric_limits<int128_t>::min)() + 1};
+    constexpr auto q {value / d};
+    constexpr auto r {value % d};
+    constexpr auto floor_res {d.floor_divide(value)};
+
+    static_assert(q == int128_t{9, UINT64_C(4120486797083267187)}, "Wrong quotient");
+    static_assert(r == -int128_t{UINT64_C(687303715884105727)}, "Wrong remainder");
+    static_assert(floor_res.quot == q, "Wrong quotient");
+
+    BOOST_TEST_EQ(q, value / -INT64_C(1000000000000000000));
+    BOOST_TEST_EQ(r, value % -INT64_C(1000000000000000000));
+}
+
+int main()
+{
+    test_unsigned_random_divisors<std::uint32_t>();
+    test_unsigned_random_divisors<std::uint64_t>();
+    test_unsigned_random_divisors<uint128_t>();
+    test_unsigned_edge_cases();
+    test_unsigned_constexpr();
+
+    test_signed_random_divisors<std::int32_t>();
+    test_signed_random_divisors<std::int64_t>();
+    test_signed_random_divisors<int128_t>();
+    test_signed_edge_cases();
+    test_signed_rounding();
+    test_signed_constexpr();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,158 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+
+using namespace boost::int128;
+
+static constexpr std::size_t N {1024U};
+static std::mt19937_64 rng(42);
+static std::uniform_int_distribution<std::uint64_t> dist(0, UINT64_MAX);
+
+// Verifies a * x + b * y == g over the full 256-bit products
+void check_identity(const int128_t a, const int128_t b, const i128gcd_t& res)
+{
+    const auto ax {mul_wide(a, res.x)};
+    const auto by {mul_wide(b, res.y)};
+
+    const auto low {ax.low + by.low};
+    const auto high {ax.high + by.high + (low < ax.low ? 1 : 0)};
+
+    BOOST_TEST_EQ(low, static_cast<uint128_t>(res.gcd));
+    BOOST_TEST_EQ(high, 0);
+}
+
+void check_extended_gcd(const int128_t a, const int128_t b)
+{
+    const auto res {extended_gcd(a, b)};
+    BOOST_TEST_EQ(res.gcd, gcd(a, b));
+    check_identity(a, b, res);
+
+    // The cofactors are the minimal ones produced by Euclid's algorithm, apart from when one operand divides the other
+    // Magnitudes are compared as unsigned values so that INT128_MIN is handled
+    if (res.gcd != 0)
+    {
+        const auto g {static_cast<uint128_t>(res.gcd)};
+        BOOST_TEST(static_cast<uint128_t>(abs(res.x)) <= static_cast<uint128_t>(abs(b)) / g / 2U + 1U);
+        BOOST_TEST(static_cast<uint128_t>(abs(res.y)) <= static_cast<uint128_t>(abs(a)) / g / 2U + 1U);
+    }
+}
+
+void test_extended_gcd()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto a {static_cast<int128_t>(uint128_t{dist(rng) >> (i % 64U), dist(rng)} >> 1U)};
+        const auto b {static_cast<int128_t>(uint128_t{dist(rng) >> ((i / 2U) % 64U), dist(rng)} >> 1U)};
+        const auto c {static_cast<int128_t>(dist(rng) >> (i % 64U))};
+
+        check_extended_gcd(a, b);
+        check_extended_gcd(-a, b);
+        check_extended_gcd(a, -b);
+        check_extended_gcd(-a, -b);
+        check_extended_gcd(b, a);
+        check_extended_gcd(a, c);
+        check_extended_gcd(c, b);
+
+        // Common factors
+        if (c != 0 && c < INT64_MAX)
+        {
+            check_extended_gcd(a / c * c, b / c * c);
+        }
+    }
+
+    // Consecutive Fibonacci numbers give the longest quotient sequence
+    int128_t f0 {0};
+    int128_t f1 {1};
+    while (f1 < (std::numeric_limits<int128_t>::max)() - f0)
+    {
+        const auto next {f0 + f1};
+        f0 = f1;
+        f1 = next;
+    }
+    check_extended_gcd(f1, f0);
+    check_extended_gcd(f0, f1);
+
+    constexpr auto max {(std::numeric_limits<int128_t>::max)()};
+    constexpr auto min {(std::numeric_limits<int128_t>::min)()};
+    check_extended_gcd(max, max - 1);
+    check_extended_gcd(max, min + 2);
+    check_extended_gcd(min, max);
+    check_extended_gcd(min, int128_t{3});
+
+    // INT128_MIN is valid whenever the gcd is below 2^127
+    check_extended_gcd(min, int128_t{1} << 126U);
+    check_extended_gcd(-(int128_t{1} << 126U), min);
+    check_extended_gcd(min, int128_t{3} << 100U);
+    check_extended_gcd(int128_t{-1}, min);
+    check_extended_gcd(min, min + 1);
+
+    const auto min_res {extended_gcd(min, int128_t{1} << 126U)};
+    BOOST_TEST_EQ(min_res.gcd, int128_t{1} << 126U);
+    BOOST_TEST(min_res.gcd > 0);
+    check_extended_gcd(int128_t{12}, int128_t{0});
+    check_extended_gcd(int128_t{0}, int128_t{-12});
+
+    constexpr auto res {extended_gcd(int128_t{240}, int128_t{46})};
+    static_assert(res.gcd == 2 && res.x == -9 && res.y == 47, "Wrong Bezout coefficients");
+
+    constexpr auto neg {extended_gcd(int128_t{-240}, int128_t{46})};
+    static_assert(neg.gcd == 2 && neg.x == 9 && neg.y == 47, "Wrong Bezout coefficients");
+}
+
+void check_mod_inverse(const uint128_t a, const uint128_t m)
+{
+    const auto inv {mod_inverse(a, m)};
+
+    if (gcd(a, m) != 1U || m <= 1U)
+    {
+        BOOST_TEST_EQ(inv, 0U);
+        return;
+    }
+
+    BOOST_TEST(inv < m);
+    BOOST_TEST_EQ(muldiv_rem(a % m, inv, m).rem, 1U);
+}
+
+void test_mod_inverse()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const uint128_t a {dist(rng), dist(rng)};
+        const uint128_t m {dist(rng) >> (i % 64U), dist(rng)};
+
+        check_mod_inverse(a, m);
+        check_mod_inverse(a, m | 1U);
+        check_mod_inverse(a >> (i % 128U), m);
+        check_mod_inverse(a, uint128_t{dist(rng) >> (i % 64U)});
+    }
+
+    // Against Fermat's little theorem for the largest prime below 2^128
+    const uint128_t p {UINT64_MAX, UINT64_MAX - 158U};
+    const modular_reducer<uint128_t> reducer {p};
+    for (std::size_t i {}; i < 64U; ++i)
+    {
+        const uint128_t a {dist(rng), dist(rng)};
+        BOOST_TEST_EQ(mod_inverse(a, p), reducer.powmod(a, p - 2U));
+    }
+
+    constexpr auto max {(std::numeric_limits<uint128_t>::max)()};
+    static_assert(mod_inverse(uint128_t{3U}, uint128_t{11U}) == 4U, "Wrong inverse");
+    static_assert(mod_inverse(uint128_t{4U}, uint128_t{8U}) == 0U, "No inverse");
+    static_assert(mod_inverse(uint128_t{5U}, uint128_t{1U}) == 0U, "No inverse");
+    static_assert(mod_inverse(uint128_t{5U}, uint128_t{0U}) == 0U, "No inverse");
+    static_assert(mod_inverse(max - 1U, max) == max - 1U, "Wrong inverse");
+    static_assert(mod_inverse(uint128_t{2U}, max) == uint128_t{UINT64_C(0x8000000000000000), 0U}, "Wrong inverse");
+}
+
+int main()
+{
+    test_extended_gcd();
+    test_mod_inverse();
+
+    return boost::report_errors();
+}
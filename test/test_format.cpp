@@ -5,6 +5,8 @@
 #include <boost/int128.hpp>
 #include <boost/int128/format.hpp>
 #include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <string>
 
 #ifdef BOOST_INT128_HAS_FORMAT
 
@@ -185,6 +187,23 @@ void test_alignment_negative()
     BOOST_TEST_CSTR_EQ(std::format("{:*^7d}", T{-42}).c_str(), "**-42**");
 }
 
+template <typename T>
+void test_output_iterator()
+{
+    // The formatter writes straight to the output, which may be a plain array or bounded
+    char buffer[200] {};
+    const auto end {std::format_to(buffer, "{:*^+#140b}", (std::numeric_limits<T>::max)())};
+    const std::string expected {std::is_same<T, boost::int128::uint128_t>::value ?
+        std::string(4U, '*').append("+0b").append(128U, '1').append(5U, '*') :
+        std::string(5U, '*').append("+0b").append(127U, '1').append(5U, '*')};
+    BOOST_TEST_EQ(static_cast<std::size_t>(end - buffer), std::size_t{140});
+    BOOST_TEST_EQ(std::string(buffer, end), expected);
+
+    const auto result {std::format_to_n(buffer, 6, "{:#020x}", T{255})};
+    BOOST_TEST_EQ(result.size, 20);
+    BOOST_TEST_EQ(std::string(buffer, result.out), "0x0000");
+}
+
 int main()
 {
     test_empty<boost::int128::uint128_t>();
@@ -209,6 +228,9 @@ int main()
     test_alignment<boost::int128::int128_t>();
     test_alignment_negative<boost::int128::int128_t>();
 
+    test_output_iterator<boost::int128::uint128_t>();
+    test_output_iterator<boost::int128::int128_t>();
+
     return boost::report_errors();
 }
 
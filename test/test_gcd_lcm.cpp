@@ -4,6 +4,7 @@
 
 #include <boost/int128.hpp>
 #include <boost/core/lightweight_test.hpp>
+#include <random>
 #include <limits>
 
 using namespace boost::int128;
@@ -52,6 +53,15 @@ void test_gcd()
     // Mixed small and large
     BOOST_TEST_EQ(gcd(T(1, 0), T(100)), T(4));
 
+    // Small even values against 2^64 + 1 = 274177 * 67280421310721
+    BOOST_TEST_EQ(gcd(T(24), T(1, 1)), T(1));
+    BOOST_TEST_EQ(gcd(T(1, 1), T(24)), T(1));
+    BOOST_TEST_EQ(gcd(T(274177 * 64), T(1, 1)), T(274177));
+
+    // Results that need more than 64 bits
+    BOOST_TEST_EQ(gcd(T(3, 3), T(5, 5)), T(1, 1));
+    BOOST_TEST_EQ(gcd(T(0x40000000, 0), T(0x60000000, 0)), T(0x20000000, 0));
+
     // Fibonacci numbers (interesting GCD patterns)
     BOOST_TEST_EQ(gcd(T(89), T(144)), T(1));
     BOOST_TEST_EQ(gcd(T(34), T(55)), T(1));
@@ -132,6 +142,78 @@ void test_gcd_lcm_properties()
     BOOST_TEST_EQ(gcd(x, gcd(y, z)), gcd(gcd(x, y), z));
 }
 
+uint128_t reference_gcd(uint128_t a, uint128_t b)
+{
+    while (b != 0U)
+    {
+        const auto r {a % b};
+        a = b;
+        b = r;
+    }
+
+    return a;
+}
+
+void test_against_euclid()
+{
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, UINT64_MAX);
+
+    constexpr std::size_t N {1024U};
+    uint128_t a[N] {};
+    uint128_t b[N] {};
+    uint128_t expected[N] {};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        // Mixes operands of equal and very different sizes, with and without a large common factor
+        const uint128_t common {i % 3U == 0U ? (dist(rng) >> (i % 64U)) | 1U : 1U};
+        a[i] = uint128_t{dist(rng) >> (i % 64U), dist(rng)} / common * common;
+        b[i] = uint128_t{dist(rng) >> ((i / 4U) % 64U), dist(rng) >> (i % 7U)} / common * common;
+        expected[i] = reference_gcd(a[i], b[i]);
+
+        BOOST_TEST_EQ(gcd(a[i], b[i]), expected[i]);
+        BOOST_TEST_EQ(gcd(b[i], a[i]), expected[i]);
+        BOOST_TEST_EQ(gcd(a[i] << (i % 16U), b[i] << (i % 5U)), reference_gcd(a[i] << (i % 16U), b[i] << (i % 5U)));
+    }
+
+    uint128_t out[N] {};
+    gcd(a, b, out, N);
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST_EQ(out[i], expected[i]);
+    }
+
+    // In place over the first operand
+    gcd(a, b, a, N);
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST_EQ(a[i], expected[i]);
+    }
+
+    const int128_t c[] {int128_t{-12}, int128_t{54}, (std::numeric_limits<int128_t>::max)(), int128_t{0}};
+    const int128_t d[] {int128_t{18}, int128_t{-24}, int128_t{7}, int128_t{-5}};
+    int128_t signed_out[4] {};
+    gcd(c, d, signed_out, 4U);
+    BOOST_TEST_EQ(signed_out[0], int128_t{6});
+    BOOST_TEST_EQ(signed_out[1], int128_t{6});
+    BOOST_TEST_EQ(signed_out[2], int128_t{1});
+    BOOST_TEST_EQ(signed_out[3], int128_t{5});
+
+    // Consecutive Fibonacci numbers are coprime
+    uint128_t f0 {0U};
+    uint128_t f1 {1U};
+    while (f1 <= (std::numeric_limits<uint128_t>::max)() - f0)
+    {
+        const auto next {f0 + f1};
+        f0 = f1;
+        f1 = next;
+        BOOST_TEST_EQ(gcd(f1, f0), 1U);
+    }
+
+    static_assert(gcd(uint128_t{UINT64_MAX, 0U}, uint128_t{0U, UINT64_MAX}) == UINT64_MAX, "Wrong gcd");
+}
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 4146)
@@ -171,6 +253,7 @@ int main()
     test_lcm<int128_t>();
     test_gcd_lcm_properties<int128_t>();
     test_negative_value();
+    test_against_euclid();
 
     return boost::report_errors();
 }
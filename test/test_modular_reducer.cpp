@@ -0,0 +1,121 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+
+using namespace boost::int128;
+
+static constexpr std::size_t N {256U};
+static std::mt19937_64 rng(42);
+static std::uniform_int_distribution<std::uint64_t> dist(0, UINT64_MAX);
+
+uint128_t reference_mulmod(const uint128_t a, const uint128_t b, const uint128_t n)
+{
+    return muldiv_rem(a, b, n).rem;
+}
+
+uint128_t reference_powmod(uint128_t base, uint128_t exponent, const uint128_t n)
+{
+    uint128_t res {n == 1U ? 0U : 1U};
+    base %= n;
+
+    while (exponent != 0U)
+    {
+        if ((exponent.low & 1U) != 0U)
+        {
+            res = reference_mulmod(res, base, n);
+        }
+
+        base = reference_mulmod(base, base, n);
+        exponent >>= 1U;
+    }
+
+    return res;
+}
+
+void check_modulus(const uint128_t n)
+{
+    const modular_reducer<uint128_t> reducer {n};
+    BOOST_TEST_EQ(reducer.modulus(), n);
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const uint128_t x {dist(rng), dist(rng)};
+        const uint128_t y {dist(rng) >> (i % 128U) % 64U, dist(rng)};
+        BOOST_TEST_EQ(reducer.reduce(x), x % n);
+        BOOST_TEST_EQ(reducer.reduce(y), y % n);
+
+        const auto a {x % n};
+        const auto b {y % n};
+        BOOST_TEST_EQ(reducer.mulmod(a, b), reference_mulmod(a, b, n));
+        BOOST_TEST_EQ(reducer.addmod(a, b), (a >= n - b ? a - (n - b) : a + b));
+        BOOST_TEST_EQ(reducer.submod(a, b), (a >= b ? a - b : n - (b - a)));
+        BOOST_TEST_EQ(reducer.submod(reducer.addmod(a, b), b), a);
+
+        // The base of powmod does not need to be reduced
+        const uint128_t exponent {dist(rng) >> (i % 64U), dist(rng)};
+        BOOST_TEST_EQ(reducer.powmod(x, exponent), reference_powmod(x, exponent, n));
+    }
+
+    BOOST_TEST_EQ(reducer.powmod(uint128_t{5U}, uint128_t{0U}), n == 1U ? 0U : 1U);
+    BOOST_TEST_EQ(reducer.powmod(uint128_t{5U}, uint128_t{1U}), uint128_t{5U} % n);
+}
+
+void test_moduli()
+{
+    constexpr uint128_t max {(std::numeric_limits<uint128_t>::max)()};
+
+    // Even moduli, powers of two and moduli above 2^127 where sums exceed 128 bits
+    constexpr uint128_t moduli[] {
+        uint128_t{1U}, uint128_t{2U}, uint128_t{3U}, uint128_t{10U}, uint128_t{UINT64_MAX}, uint128_t{1U, 0U},
+        uint128_t{1U, 1U}, uint128_t{UINT64_C(0x8000000000000000), 0U}, max, max - 1U,
+        uint128_t{UINT64_C(10000000000000000000), 12344U}, uint128_t{0U, UINT64_C(10000000000000000000)}
+    };
+
+    for (const auto& n : moduli)
+    {
+        check_modulus(n);
+    }
+
+    for (std::size_t i {}; i < 32U; ++i)
+    {
+        const auto n {uint128_t{dist(rng), dist(rng)} >> (i * 4U)};
+        check_modulus(n == 0U ? uint128_t{2U} : n);
+    }
+}
+
+void test_constexpr()
+{
+    // 10^38 and a modulus above 2^127
+    constexpr auto n {BOOST_INT128_UINT128_C(100000000000000000000000000000000000000)};
+    constexpr modular_reducer<uint128_t> reducer {n};
+    constexpr auto max {(std::numeric_limits<uint128_t>::max)()};
+
+    static_assert(reducer.reduce(max) == BOOST_INT128_UINT128_C(40282366920938463463374607431768211455), "Wrong remainder");
+    static_assert(reducer.mulmod(n - 1U, n - 1U) == 1U, "Wrong product");
+    static_assert(reducer.addmod(n - 1U, n - 2U) == n - 3U, "Wrong sum");
+    static_assert(reducer.submod(uint128_t{1U}, uint128_t{2U}) == n - 1U, "Wrong difference");
+    static_assert(reducer.powmod(uint128_t{10U}, uint128_t{38U}) == 0U, "Wrong power");
+    static_assert(reducer.powmod(uint128_t{10U}, uint128_t{37U}) == n / 10U, "Wrong power");
+
+    constexpr modular_reducer<uint128_t> big {max};
+    static_assert(big.addmod(max - 1U, max - 1U) == max - 2U, "Wrong sum");
+    static_assert(big.mulmod(max - 1U, uint128_t{2U}) == max - 2U, "Wrong product");
+
+    // 2^127 mod 2^64 and 3^4 mod 2^64
+    constexpr modular_reducer<uint128_t> pow2 {uint128_t{1U, 0U}};
+    static_assert(pow2.powmod(uint128_t{2U}, uint128_t{127U}) == 0U, "Wrong power");
+    static_assert(pow2.powmod(uint128_t{3U}, uint128_t{4U}) == 81U, "Wrong power");
+}
+
+int main()
+{
+    test_moduli();
+    test_constexpr();
+
+    return boost::report_errors();
+}
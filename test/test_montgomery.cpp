@@ -0,0 +1,126 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/int128/modular.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+
+using namespace boost::int128;
+
+static constexpr std::size_t N {256U};
+static std::mt19937_64 rng(42);
+static std::uniform_int_distribution<std::uint64_t> dist(0, UINT64_MAX);
+
+// M127 = 2^127 - 1 and the largest prime below 2^128
+static constexpr uint128_t m127 {UINT64_C(0x7FFFFFFFFFFFFFFF), UINT64_MAX};
+static constexpr uint128_t p128 {UINT64_MAX, UINT64_MAX - 158U};
+
+uint128_t reference_mulmod(const uint128_t a, const uint128_t b, const uint128_t n)
+{
+    return muldiv_rem(a, b, n).rem;
+}
+
+uint128_t reference_powmod(uint128_t base, uint128_t exponent, const uint128_t n)
+{
+    uint128_t res {n == 1U ? 0U : 1U};
+    base %= n;
+
+    while (exponent != 0U)
+    {
+        if ((exponent.low & 1U) != 0U)
+        {
+            res = reference_mulmod(res, base, n);
+        }
+
+        base = reference_mulmod(base, base, n);
+        exponent >>= 1U;
+    }
+
+    return res;
+}
+
+void check_modulus(const uint128_t n)
+{
+    const montgomery_context<uint128_t> ctx {n};
+    BOOST_TEST_EQ(ctx.modulus(), n);
+    BOOST_TEST_EQ(ctx.from_mont(ctx.one()), n == 1U ? 0U : 1U);
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        // Inputs to to_mont do not need to be reduced
+        const uint128_t a {dist(rng), dist(rng)};
+        const uint128_t b {dist(rng) >> (i % 128U) % 64U, dist(rng)};
+
+        const auto a_mont {ctx.to_mont(a)};
+        const auto b_mont {ctx.to_mont(b)};
+        BOOST_TEST(a_mont < n);
+        BOOST_TEST_EQ(ctx.from_mont(a_mont), a % n);
+
+        BOOST_TEST_EQ(ctx.from_mont(ctx.mul(a_mont, b_mont)), reference_mulmod(a, b, n));
+        BOOST_TEST_EQ(ctx.from_mont(ctx.square(a_mont)), reference_mulmod(a, a, n));
+        BOOST_TEST_EQ(ctx.square(a_mont), ctx.mul(a_mont, a_mont));
+
+        const uint128_t exponent {dist(rng) >> (i % 64U), dist(rng)};
+        BOOST_TEST_EQ(ctx.from_mont(ctx.pow(a_mont, exponent)), reference_powmod(a, exponent, n));
+    }
+
+    BOOST_TEST_EQ(ctx.pow(ctx.to_mont(uint128_t{5U}), uint128_t{0U}), ctx.one());
+    BOOST_TEST_EQ(ctx.pow(ctx.to_mont(uint128_t{5U}), uint128_t{1U}), ctx.to_mont(uint128_t{5U}));
+}
+
+void test_moduli()
+{
+    constexpr uint128_t max {(std::numeric_limits<uint128_t>::max)()};
+
+    // Includes moduli above 2^127 where the intermediate sum in the reduction exceeds 128 bits
+    constexpr uint128_t moduli[] {
+        uint128_t{1U}, uint128_t{3U}, uint128_t{UINT64_MAX}, uint128_t{1U, 1U}, m127, p128, max,
+        uint128_t{UINT64_C(0x8000000000000000), 1U}, uint128_t{UINT64_C(10000000000000000000), 12345U}
+    };
+
+    for (const auto& n : moduli)
+    {
+        check_modulus(n);
+    }
+
+    for (std::size_t i {}; i < 16U; ++i)
+    {
+        check_modulus(uint128_t{dist(rng) >> (i * 4U), dist(rng) | 1U});
+    }
+}
+
+void test_fermat()
+{
+    for (const auto& p : {m127, p128})
+    {
+        const montgomery_context<uint128_t> ctx {p};
+
+        for (std::size_t i {}; i < N; ++i)
+        {
+            const uint128_t a {dist(rng), dist(rng) | 1U};
+            if (a % p == 0U)
+            {
+                continue;
+            }
+
+            BOOST_TEST_EQ(ctx.pow(ctx.to_mont(a), p - 1U), ctx.one());
+        }
+    }
+
+    // 2^127 = 1 and 2^128 = 2 mod M127
+    constexpr montgomery_context<uint128_t> ctx {m127};
+    static_assert(ctx.from_mont(ctx.pow(ctx.to_mont(uint128_t{2U}), uint128_t{127U})) == 1U, "Wrong power");
+    static_assert(ctx.from_mont(ctx.mul(ctx.to_mont(m127 - 1U), ctx.to_mont(m127 - 1U))) == 1U, "Wrong product");
+    static_assert(ctx.from_mont(ctx.square(ctx.to_mont(uint128_t{1U, 0U}))) == 2U, "Wrong square");
+}
+
+int main()
+{
+    test_moduli();
+    test_fermat();
+
+    return boost::report_errors();
+}
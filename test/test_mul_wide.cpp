@@ -0,0 +1,128 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+
+using namespace boost::int128;
+
+static constexpr std::size_t N {1024U};
+static std::mt19937_64 rng(42);
+static std::uniform_int_distribution<std::uint64_t> dist(0, UINT64_MAX);
+
+// Schoolbook multiplication of the 64-bit halves using only 128-bit operations
+u128mul_t reference_mul(const uint128_t x, const uint128_t y)
+{
+    const auto p00 {uint128_t{x.low} * y.low};
+    const auto p01 {uint128_t{x.low} * y.high};
+    const auto p10 {uint128_t{x.high} * y.low};
+    const auto p11 {uint128_t{x.high} * y.high};
+
+    const auto middle {(p00 >> 64U) + uint128_t{p01.low} + uint128_t{p10.low}};
+
+    u128mul_t res {};
+    res.low = (middle << 64U) | uint128_t{p00.low};
+    res.high = p11 + uint128_t{p01.high} + uint128_t{p10.high} + (middle >> 64U);
+
+    return res;
+}
+
+// Two's complement negation of the 256-bit value
+i128mul_t negate(const i128mul_t value)
+{
+    const auto low {~value.low + 1U};
+    const auto high {~value.high + (low == 0U ? 1 : 0)};
+
+    return {high, low};
+}
+
+void test_unsigned()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const uint128_t x {dist(rng), dist(rng)};
+        const uint128_t y {dist(rng) >> (i % 64U), dist(rng)};
+
+        const auto res {mul_wide(x, y)};
+        const auto ref {reference_mul(x, y)};
+
+        BOOST_TEST_EQ(res.high, ref.high);
+        BOOST_TEST_EQ(res.low, ref.low);
+        BOOST_TEST_EQ(res.low, x * y);
+        BOOST_TEST_EQ(mulhi(x, y), ref.high);
+        BOOST_TEST_EQ(mulhi(y, x), ref.high);
+    }
+
+    constexpr auto max {(std::numeric_limits<uint128_t>::max)()};
+
+    constexpr auto max_squared {mul_wide(max, max)};
+    static_assert(max_squared.high == max - 1U, "Wrong high half");
+    static_assert(max_squared.low == 1U, "Wrong low half");
+
+    static_assert(mulhi(max, uint128_t{1U, 0U}) == uint128_t{UINT64_MAX}, "Wrong high half");
+    static_assert(mulhi(max, uint128_t{0U, 0U}) == 0U, "Wrong high half");
+    static_assert(mulhi(uint128_t{1U, 0U}, uint128_t{1U, 0U}) == 1U, "Wrong high half");
+}
+
+void test_signed()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const uint128_t ux {dist(rng) >> 1U, dist(rng)};
+        const uint128_t uy {dist(rng) >> (1U + i % 63U), dist(rng)};
+        const auto x {static_cast<int128_t>(ux)};
+        const auto y {static_cast<int128_t>(uy)};
+
+        // Both operands are non-negative so this must agree with the unsigned product
+        const auto ref {reference_mul(ux, uy)};
+        const auto pos {mul_wide(x, y)};
+        BOOST_TEST_EQ(pos.high, static_cast<int128_t>(ref.high));
+        BOOST_TEST_EQ(pos.low, ref.low);
+
+        const auto neg {negate(pos)};
+
+        const auto neg_lhs {mul_wide(-x, y)};
+        BOOST_TEST_EQ(neg_lhs.high, neg.high);
+        BOOST_TEST_EQ(neg_lhs.low, neg.low);
+
+        const auto neg_rhs {mul_wide(x, -y)};
+        BOOST_TEST_EQ(neg_rhs.high, neg.high);
+        BOOST_TEST_EQ(neg_rhs.low, neg.low);
+
+        const auto neg_both {mul_wide(-x, -y)};
+        BOOST_TEST_EQ(neg_both.high, pos.high);
+        BOOST_TEST_EQ(neg_both.low, pos.low);
+
+        BOOST_TEST_EQ(mulhi(-x, y), neg.high);
+        BOOST_TEST_EQ(static_cast<int128_t>(neg_lhs.low), -x * y);
+    }
+
+    constexpr auto min {(std::numeric_limits<int128_t>::min)()};
+    constexpr auto max {(std::numeric_limits<int128_t>::max)()};
+
+    constexpr auto min_squared {mul_wide(min, min)};
+    static_assert(min_squared.high == int128_t{INT64_C(0x4000000000000000), 0U}, "Wrong high half");
+    static_assert(min_squared.low == 0U, "Wrong low half");
+
+    constexpr auto min_neg_one {mul_wide(min, int128_t{-1})};
+    static_assert(min_neg_one.high == 0, "Wrong high half");
+    static_assert(min_neg_one.low == uint128_t{UINT64_C(0x8000000000000000), 0U}, "Wrong low half");
+
+    constexpr auto min_max {mul_wide(min, max)};
+    static_assert(min_max.high == int128_t{INT64_C(-0x4000000000000000), 0U}, "Wrong high half");
+    static_assert(min_max.low == uint128_t{UINT64_C(0x8000000000000000), 0U}, "Wrong low half");
+
+    static_assert(mulhi(int128_t{-1}, int128_t{1}) == -1, "Wrong high half");
+    static_assert(mulhi(int128_t{-1}, int128_t{-1}) == 0, "Wrong high half");
+}
+
+int main()
+{
+    test_unsigned();
+    test_signed();
+
+    return boost::report_errors();
+}
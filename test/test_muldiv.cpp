@@ -0,0 +1,215 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+
+using namespace boost::int128;
+
+static constexpr std::size_t N {1024U};
+static std::mt19937_64 rng(42);
+static std::uniform_int_distribution<std::uint64_t> dist(0, UINT64_MAX);
+
+// Verifies quot * c + rem == a * b over the full 256 bits
+void check_identity(const uint128_t a, const uint128_t b, const uint128_t c)
+{
+    const auto product {mul_wide(a, b)};
+    if (product.high >= c)
+    {
+        return;
+    }
+
+    const auto res {muldiv_rem(a, b, c)};
+    BOOST_TEST(res.rem < c);
+    BOOST_TEST_EQ(muldiv(a, b, c), res.quot);
+
+    auto back {mul_wide(res.quot, c)};
+    back.low += res.rem;
+    back.high += back.low < res.rem ? 1U : 0U;
+
+    BOOST_TEST_EQ(back.high, product.high);
+    BOOST_TEST_EQ(back.low, product.low);
+}
+
+void test_unsigned()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const uint128_t a {dist(rng), dist(rng)};
+        const uint128_t b {dist(rng) >> (i % 64U), dist(rng)};
+
+        check_identity(a, b, uint128_t{dist(rng), dist(rng)});
+        check_identity(a, b, uint128_t{dist(rng) >> (i % 64U), dist(rng)});
+        check_identity(a, b, uint128_t{dist(rng) >> (i % 64U)});
+        check_identity(a, b, uint128_t{dist(rng) >> 32U});
+
+        // When the product fits the result must match plain division
+        const uint128_t small_a {dist(rng)};
+        const uint128_t small_b {dist(rng)};
+        const uint128_t c {(dist(rng) >> (i % 64U)) | 1U};
+        BOOST_TEST_EQ(muldiv(small_a, small_b, c), small_a * small_b / c);
+        BOOST_TEST_EQ(muldiv_rem(small_a, small_b, c).rem, small_a * small_b % c);
+    }
+
+    const auto a {BOOST_INT128_UINT128_C(1000000000000000000000000000000)};
+    const auto b {BOOST_INT128_UINT128_C(30000000000000000000000007)};
+    const auto c {BOOST_INT128_UINT128_C(700000000000000003)};
+    BOOST_TEST_EQ(muldiv(a, b, c), (uint128_t{UINT64_C(2323290369611795205), UINT64_C(14264826924018954609)}));
+    BOOST_TEST_EQ(muldiv_rem(a, b, c).rem, uint128_t{UINT64_C(148949591836732333)});
+
+    constexpr auto max {(std::numeric_limits<uint128_t>::max)()};
+    static_assert(muldiv(max, max, max) == max, "Wrong quotient");
+    static_assert(muldiv_rem(max, max, max).rem == 0U, "Wrong remainder");
+
+    constexpr auto res {muldiv_rem(max, max / 3U, max - 4U)};
+    static_assert(res.quot == uint128_t{UINT64_C(6148914691236517205), UINT64_C(6148914691236517206)}, "Wrong quotient");
+    static_assert(res.rem == uint128_t{UINT64_C(6148914691236517205), UINT64_C(6148914691236517209)}, "Wrong remainder");
+
+    // Division by zero
+    static_assert(muldiv(max, max, uint128_t{0U}) == 0U, "Wrong quotient");
+    static_assert(muldiv_rem(max, max, uint128_t{0U}).rem == 0U, "Wrong remainder");
+}
+
+void test_unsigned_rounding()
+{
+    constexpr uint128_t one {1U};
+
+    // 7 / 2 = 3.5
+    static_assert(muldiv(uint128_t{7U}, one, uint128_t{2U}) == 3U, "Wrong quotient");
+    static_assert(muldiv(uint128_t{7U}, one, uint128_t{2U}, rounding_mode::floor) == 3U, "Wrong quotient");
+    static_assert(muldiv(uint128_t{7U}, one, uint128_t{2U}, rounding_mode::ceil) == 4U, "Wrong quotient");
+    static_assert(muldiv(uint128_t{7U}, one, uint128_t{2U}, rounding_mode::half_even) == 4U, "Wrong quotient");
+
+    // 5 / 2 = 2.5
+    static_assert(muldiv(uint128_t{5U}, one, uint128_t{2U}, rounding_mode::half_even) == 2U, "Wrong quotient");
+
+    // 8 / 3 = 2.67 and 7 / 3 = 2.33
+    static_assert(muldiv(uint128_t{8U}, one, uint128_t{3U}, rounding_mode::half_even) == 3U, "Wrong quotient");
+    static_assert(muldiv(uint128_t{7U}, one, uint128_t{3U}, rounding_mode::half_even) == 2U, "Wrong quotient");
+    static_assert(muldiv(uint128_t{6U}, one, uint128_t{3U}, rounding_mode::ceil) == 2U, "Wrong quotient");
+
+    // Remainders at the top of the range where 2 * rem would overflow
+    constexpr auto max {(std::numeric_limits<uint128_t>::max)()};
+    constexpr auto half {uint128_t{UINT64_C(0x8000000000000000), 0U}};
+    static_assert(muldiv(max, one, max - 1U, rounding_mode::half_even) == 1U, "Wrong quotient");
+    static_assert(muldiv(half + 1U, uint128_t{3U}, half + 2U, rounding_mode::half_even) == 3U, "Wrong quotient");
+
+    // Exact ties with c = 2^128 - 2 and rem = c / 2
+    static_assert(muldiv(uint128_t{3U}, half - 1U, max - 1U, rounding_mode::half_even) == 2U, "Wrong quotient");
+    static_assert(muldiv(uint128_t{5U}, half - 1U, max - 1U, rounding_mode::half_even) == 2U, "Wrong quotient");
+    static_assert(muldiv(uint128_t{5U}, half - 1U, max - 1U, rounding_mode::ceil) == 3U, "Wrong quotient");
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const uint128_t a {dist(rng), dist(rng)};
+        const uint128_t b {dist(rng) >> (i % 64U), dist(rng)};
+        const uint128_t c {dist(rng), dist(rng)};
+
+        if (mul_wide(a, b).high >= c)
+        {
+            continue;
+        }
+
+        const auto res {muldiv_rem(a, b, c)};
+        const auto round_up {res.rem != 0U ? 1U : 0U};
+
+        BOOST_TEST_EQ(muldiv(a, b, c, rounding_mode::floor), res.quot);
+        BOOST_TEST_EQ(muldiv(a, b, c, rounding_mode::ceil), res.quot + round_up);
+
+        const auto nearest {muldiv(a, b, c, rounding_mode::half_even)};
+        BOOST_TEST(nearest == res.quot || nearest == res.quot + 1U);
+        BOOST_TEST_EQ(nearest == res.quot + 1U, res.rem > c - res.rem);
+    }
+}
+
+void test_signed()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const uint128_t ua {dist(rng) >> 1U, dist(rng)};
+        const uint128_t ub {dist(rng) >> (1U + i % 63U), dist(rng)};
+        const uint128_t uc {dist(rng) >> 1U, dist(rng)};
+
+        const auto a {static_cast<int128_t>(ua)};
+        const auto b {static_cast<int128_t>(ub)};
+        const auto c {static_cast<int128_t>(uc)};
+
+        if (mul_wide(ua, ub).high >= uc)
+        {
+            continue;
+        }
+
+        const auto ures {muldiv_rem(ua, ub, uc)};
+        const auto q {static_cast<int128_t>(ures.quot)};
+        const auto r {static_cast<int128_t>(ures.rem)};
+
+        // Signs follow truncating division: quotient by the sign of the result, remainder by the product
+        const auto res {muldiv_rem(a, b, c)};
+        BOOST_TEST_EQ(res.quot, q);
+        BOOST_TEST_EQ(res.rem, r);
+
+        const auto neg_a {muldiv_rem(-a, b, c)};
+        BOOST_TEST_EQ(neg_a.quot, -q);
+        BOOST_TEST_EQ(neg_a.rem, -r);
+
+        const auto neg_c {muldiv_rem(a, b, -c)};
+        BOOST_TEST_EQ(neg_c.quot, -q);
+        BOOST_TEST_EQ(neg_c.rem, r);
+
+        const auto neg_all {muldiv_rem(-a, -b, -c)};
+        BOOST_TEST_EQ(neg_all.quot, -q);
+        BOOST_TEST_EQ(neg_all.rem, r);
+
+        const auto inexact {r != 0 ? 1 : 0};
+        BOOST_TEST_EQ(muldiv(-a, b, c), -q);
+        BOOST_TEST_EQ(muldiv(-a, b, c, rounding_mode::floor), -q - inexact);
+        BOOST_TEST_EQ(muldiv(-a, b, c, rounding_mode::ceil), -q);
+        BOOST_TEST_EQ(muldiv(a, b, c, rounding_mode::floor), q);
+        BOOST_TEST_EQ(muldiv(a, b, c, rounding_mode::ceil), q + inexact);
+        BOOST_TEST_EQ(muldiv(a, -b, c, rounding_mode::half_even), -muldiv(a, b, c, rounding_mode::half_even));
+    }
+
+    constexpr int128_t one {1};
+
+    // -7 / 2 = -3.5
+    static_assert(muldiv(int128_t{-7}, one, int128_t{2}) == -3, "Wrong quotient");
+    static_assert(muldiv(int128_t{-7}, one, int128_t{2}, rounding_mode::floor) == -4, "Wrong quotient");
+    static_assert(muldiv(int128_t{-7}, one, int128_t{2}, rounding_mode::ceil) == -3, "Wrong quotient");
+    static_assert(muldiv(int128_t{-7}, one, int128_t{2}, rounding_mode::half_even) == -4, "Wrong quotient");
+    static_assert(muldiv(int128_t{7}, one, int128_t{-2}, rounding_mode::half_even) == -4, "Wrong quotient");
+
+    // -5 / 2 = -2.5 and -7 / 3 = -2.33
+    static_assert(muldiv(int128_t{-5}, one, int128_t{2}, rounding_mode::half_even) == -2, "Wrong quotient");
+    static_assert(muldiv(int128_t{-7}, one, int128_t{3}, rounding_mode::half_even) == -2, "Wrong quotient");
+    static_assert(muldiv(int128_t{-7}, one, int128_t{3}, rounding_mode::floor) == -3, "Wrong quotient");
+    static_assert(muldiv(int128_t{-7}, one, int128_t{-3}, rounding_mode::floor) == 2, "Wrong quotient");
+    static_assert(muldiv(int128_t{-7}, one, int128_t{-3}, rounding_mode::ceil) == 3, "Wrong quotient");
+
+    static_assert(muldiv_rem(int128_t{-7}, one, int128_t{2}).rem == -1, "Wrong remainder");
+    static_assert(muldiv_rem(int128_t{7}, one, int128_t{-2}).rem == 1, "Wrong remainder");
+
+    // Full range operands
+    constexpr auto min {(std::numeric_limits<int128_t>::min)()};
+    constexpr auto max {(std::numeric_limits<int128_t>::max)()};
+    static_assert(muldiv(min, min, min) == min, "Wrong quotient");
+    static_assert(muldiv(max, min, max) == min, "Wrong quotient");
+    static_assert(muldiv(max, max, min) == -max + 1, "Wrong quotient");
+    static_assert(muldiv(max, max, min, rounding_mode::floor) == -max, "Wrong quotient");
+    static_assert(muldiv(min, int128_t{-1}, int128_t{-1}) == min, "Wrong quotient");
+
+    // Division by zero
+    static_assert(muldiv(max, max, int128_t{0}) == 0, "Wrong quotient");
+    static_assert(muldiv_rem(max, max, int128_t{0}).rem == 0, "Wrong remainder");
+}
+
+int main()
+{
+    test_unsigned();
+    test_unsigned_rounding();
+    test_signed();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,160 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+using namespace boost::int128;
+
+static std::mt19937_64 rng(42);
+
+void test_small()
+{
+    constexpr std::size_t limit {100000U};
+    std::vector<bool> sieve(limit, true);
+    sieve[0] = false;
+    sieve[1] = false;
+    for (std::size_t i {2U}; i * i < limit; ++i)
+    {
+        if (sieve[i])
+        {
+            for (std::size_t j {i * i}; j < limit; j += i)
+            {
+                sieve[j] = false;
+            }
+        }
+    }
+
+    for (std::size_t i {}; i < limit; ++i)
+    {
+        BOOST_TEST_EQ(is_prime(uint128_t{i}), sieve[i]);
+    }
+}
+
+void test_large()
+{
+    // Mersenne primes and the largest primes below 2^64 and 2^128
+    constexpr uint128_t primes[] {
+        uint128_t{UINT64_C(0x1FFFFFFFFFFFFFFF)},
+        uint128_t{UINT64_C(18446744073709551557)},
+        uint128_t{UINT64_C(18446744073709551533)},
+        uint128_t{UINT64_C(0x1FFFFFF), UINT64_MAX},
+        uint128_t{UINT64_C(0x7FFFFFFFFFF), UINT64_MAX},
+        uint128_t{UINT64_C(0x7FFFFFFFFFFFFFFF), UINT64_MAX},
+        uint128_t{UINT64_C(0x8000000000000000), 45U},
+        uint128_t{UINT64_MAX, UINT64_MAX - 158U}
+    };
+
+    for (const auto& p : primes)
+    {
+        BOOST_TEST(is_prime(p));
+        BOOST_TEST(!is_prime(p + 2U));
+    }
+
+    // Carmichael numbers, strong pseudoprimes to base 2, strong Lucas pseudoprimes,
+    // and psi_11 and psi_13, which are strong pseudoprimes to the first 11 and 13 prime bases
+    constexpr uint128_t composites[] {
+        uint128_t{561U}, uint128_t{41041U}, uint128_t{2047U}, uint128_t{3215031751U}, uint128_t{5459U}, uint128_t{5777U},
+        uint128_t{10877U}, uint128_t{UINT64_C(3825123056546413051)},
+        BOOST_INT128_UINT128_C(3317044064679887385961981),
+        (std::numeric_limits<uint128_t>::max)(),
+        uint128_t{UINT64_C(18446744073709551557)} * UINT64_C(18446744073709551533),
+        uint128_t{UINT64_C(0x1FFFFFFFFFFFFFFF)} * UINT64_C(0x1FFFFFFFFFFFFFFF)
+    };
+
+    for (const auto& n : composites)
+    {
+        BOOST_TEST(!is_prime(n));
+    }
+
+    static_assert(is_prime(uint128_t{UINT64_C(0x7FFFFFFFFFFFFFFF), UINT64_MAX}), "M127 is prime");
+    static_assert(!is_prime(BOOST_INT128_UINT128_C(3317044064679887385961981)), "psi_13 is composite");
+}
+
+std::vector<uint128_t> factors_of(const uint128_t n)
+{
+    std::vector<uint128_t> res;
+    factor(n, std::back_inserter(res));
+    return res;
+}
+
+void test_factor()
+{
+    BOOST_TEST(factors_of(uint128_t{0U}).empty());
+    BOOST_TEST(factors_of(uint128_t{1U}).empty());
+
+    const std::vector<uint128_t> fermat {
+        uint128_t{3U}, uint128_t{5U}, uint128_t{17U}, uint128_t{257U}, uint128_t{641U}, uint128_t{65537U},
+        uint128_t{274177U}, uint128_t{6700417U}, uint128_t{UINT64_C(67280421310721)}
+    };
+    BOOST_TEST(factors_of((std::numeric_limits<uint128_t>::max)()) == fermat);
+
+    const std::vector<uint128_t> psi_13 {uint128_t{UINT64_C(1287836182261)}, uint128_t{UINT64_C(2575672364521)}};
+    BOOST_TEST(factors_of(BOOST_INT128_UINT128_C(3317044064679887385961981)) == psi_13);
+
+    const std::vector<uint128_t> powers {
+        uint128_t{2U}, uint128_t{2U}, uint128_t{1000003U}, uint128_t{1000003U}, uint128_t{1000003U}
+    };
+    BOOST_TEST(factors_of(uint128_t{4U} * 1000003U * 1000003U * 1000003U) == powers);
+
+    const uint128_t m127 {UINT64_C(0x7FFFFFFFFFFFFFFF), UINT64_MAX};
+    BOOST_TEST(factors_of(m127) == std::vector<uint128_t>{m127});
+    BOOST_TEST(factors_of(m127 * 2U) == (std::vector<uint128_t>{uint128_t{2U}, m127}));
+
+    // Products of random primes of up to 32 bits, filled to no more than 128 bits
+    std::uniform_int_distribution<std::uint64_t> dist(2U, UINT32_MAX);
+    for (int i {}; i < 64; ++i)
+    {
+        std::vector<uint128_t> expected;
+        uint128_t n {1U};
+
+        for (int j {}; j < 8; ++j)
+        {
+            auto p {dist(rng) >> (i % 24)};
+            while (!is_prime(uint128_t{p}))
+            {
+                ++p;
+            }
+
+            if (mulhi(n, uint128_t{p}) != 0U)
+            {
+                break;
+            }
+
+            n *= p;
+            expected.emplace_back(p);
+        }
+
+        std::sort(expected.begin(), expected.end());
+        BOOST_TEST(factors_of(n) == expected);
+    }
+}
+
+constexpr uint128_t largest_factor(const uint128_t n)
+{
+    uint128_t res[128] {};
+    const auto last {factor(n, res)};
+    return last == res ? uint128_t{0U} : *(last - 1);
+}
+
+void test_constexpr()
+{
+    static_assert(largest_factor(uint128_t{1U}) == 0U, "No factors");
+    static_assert(largest_factor(uint128_t{UINT64_C(0x8000000000000000), 0U}) == 2U, "Wrong factor");
+    static_assert(largest_factor(uint128_t{274177U} * 6700417U) == 6700417U, "Wrong factor");
+}
+
+int main()
+{
+    test_small();
+    test_large();
+    test_factor();
+    test_constexpr();
+
+    return boost::report_errors();
+}
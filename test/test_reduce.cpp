@@ -0,0 +1,233 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/int128/soa_vector.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+
+using namespace boost::int128;
+
+static constexpr std::size_t N {67U};
+static std::mt19937_64 rng(42);
+
+template <typename T>
+T random_value(const std::size_t i)
+{
+    // Few distinct high words means many comparisons are decided by the low words
+    constexpr std::uint64_t highs[] {0U, 1U, UINT64_MAX, UINT64_C(0x8000000000000000), UINT64_C(0x7FFFFFFFFFFFFFFF)};
+
+    switch (i % 3U)
+    {
+        case 0U:
+            return static_cast<T>(uint128_t{highs[rng() % 5U], rng()});
+        case 1U:
+            return static_cast<T>(uint128_t{highs[rng() % 5U], UINT64_MAX});
+        default:
+            return static_cast<T>(uint128_t{rng(), rng()});
+    }
+}
+
+// Reference results from scalar loops, counting how many times the running sum wraps
+bool reference_sum_checked(uint128_t* result, const uint128_t* a, const std::size_t n)
+{
+    uint128_t sum {};
+    bool wrapped {};
+    for (std::size_t i {}; i < n; ++i)
+    {
+        sum += a[i];
+        wrapped = wrapped || sum < a[i];
+    }
+
+    *result = sum;
+    return wrapped;
+}
+
+bool reference_sum_checked(int128_t* result, const int128_t* a, const std::size_t n)
+{
+    int128_t sum {};
+    int wraps {};
+    for (std::size_t i {}; i < n; ++i)
+    {
+        const auto next {static_cast<int128_t>(static_cast<uint128_t>(sum) + static_cast<uint128_t>(a[i]))};
+        if (a[i] >= 0 && next < sum)
+        {
+            ++wraps;
+        }
+        else if (a[i] < 0 && next > sum)
+        {
+            --wraps;
+        }
+        sum = next;
+    }
+
+    *result = sum;
+    return wraps != 0;
+}
+
+template <typename T>
+void test_arrays()
+{
+    T a[N] {};
+    for (std::size_t i {}; i < N; ++i)
+    {
+        a[i] = random_value<T>(i);
+    }
+
+    soa_vector<T> soa;
+
+    // Every length up to N covers both the vector loop and the scalar tail
+    for (std::size_t n {}; n <= N; ++n)
+    {
+        T expected_sum {};
+        const auto expected_overflow {reference_sum_checked(&expected_sum, a, n)};
+
+        T expected_min {(std::numeric_limits<T>::max)()};
+        T expected_max {(std::numeric_limits<T>::min)()};
+        for (std::size_t i {}; i < n; ++i)
+        {
+            expected_min = a[i] < expected_min ? a[i] : expected_min;
+            expected_max = a[i] > expected_max ? a[i] : expected_max;
+        }
+
+        BOOST_TEST_EQ(reduce_sum(a, n), expected_sum);
+        BOOST_TEST_EQ(reduce_min(a, n), expected_min);
+        BOOST_TEST_EQ(reduce_max(a, n), expected_max);
+
+        T sum {};
+        BOOST_TEST_EQ(reduce_sum_checked(&sum, a, n), expected_overflow);
+        BOOST_TEST_EQ(sum, expected_sum);
+
+        BOOST_TEST_EQ(reduce_sum(soa), expected_sum);
+        BOOST_TEST_EQ(reduce_min(soa), expected_min);
+        BOOST_TEST_EQ(reduce_max(soa), expected_max);
+
+        sum = T{};
+        BOOST_TEST_EQ(reduce_sum_checked(&sum, soa), expected_overflow);
+        BOOST_TEST_EQ(sum, expected_sum);
+
+        if (n < N)
+        {
+            soa.push_back(a[n]);
+        }
+    }
+}
+
+template <typename T>
+void test_extremum_position()
+{
+    // The extremum in every position of the vector loop and the tail, among values sharing its high word
+    T a[N] {};
+    for (std::size_t pos {}; pos < N; ++pos)
+    {
+        for (std::size_t i {}; i < N; ++i)
+        {
+            a[i] = static_cast<T>(uint128_t{UINT64_MAX, UINT64_C(1000) + i % 7U});
+        }
+
+        a[pos] = static_cast<T>(uint128_t{UINT64_MAX, UINT64_C(2000)});
+        BOOST_TEST_EQ(reduce_max(a, N), a[pos]);
+
+        a[pos] = static_cast<T>(uint128_t{UINT64_MAX, UINT64_C(10)});
+        BOOST_TEST_EQ(reduce_min(a, N), a[pos]);
+
+        const soa_vector<T> soa(a, a + N);
+        BOOST_TEST_EQ(reduce_min(soa), a[pos]);
+    }
+}
+
+void test_overflow()
+{
+    constexpr auto umax {(std::numeric_limits<uint128_t>::max)()};
+    constexpr auto imax {(std::numeric_limits<int128_t>::max)()};
+    constexpr auto imin {(std::numeric_limits<int128_t>::min)()};
+
+    uint128_t ua[N] {};
+    for (auto& value : ua)
+    {
+        value = umax;
+    }
+
+    uint128_t usum {};
+    BOOST_TEST(!reduce_sum_checked(&usum, ua, 1U));
+    BOOST_TEST_EQ(usum, umax);
+    BOOST_TEST(reduce_sum_checked(&usum, ua, 2U));
+    BOOST_TEST_EQ(usum, umax - 1U);
+    BOOST_TEST(reduce_sum_checked(&usum, ua, N));
+    BOOST_TEST_EQ(usum, umax - (N - 1U));
+    BOOST_TEST_EQ(reduce_sum(ua, N), umax - (N - 1U));
+
+    int128_t ia[N] {};
+    for (auto& value : ia)
+    {
+        value = imax;
+    }
+
+    int128_t isum {};
+    BOOST_TEST(!reduce_sum_checked(&isum, ia, 1U));
+    BOOST_TEST(reduce_sum_checked(&isum, ia, N / 2U));
+    BOOST_TEST_EQ(isum, reduce_sum(ia, N / 2U));
+
+    // Positive and negative overflows which cancel out give an exact result
+    const int128_t cancel[] {imax, imax, imax, imax, imax, -imax, -imax, -imax, -imax, imin, int128_t{1}, imin, int128_t{-1}};
+    BOOST_TEST(!reduce_sum_checked(&isum, cancel, 9U));
+    BOOST_TEST_EQ(isum, imax);
+    BOOST_TEST(!reduce_sum_checked(&isum, cancel, 10U));
+    BOOST_TEST_EQ(isum, -1);
+    BOOST_TEST(!reduce_sum_checked(&isum, cancel, 11U));
+    BOOST_TEST_EQ(isum, 0);
+    BOOST_TEST(!reduce_sum_checked(&isum, cancel, 12U));
+    BOOST_TEST_EQ(isum, imin);
+    BOOST_TEST(reduce_sum_checked(&isum, cancel, 13U));
+    BOOST_TEST_EQ(isum, imax);
+
+    for (auto& value : ia)
+    {
+        value = imin;
+    }
+    BOOST_TEST(!reduce_sum_checked(&isum, ia, 1U));
+    BOOST_TEST_EQ(isum, imin);
+    BOOST_TEST(reduce_sum_checked(&isum, ia, N));
+    BOOST_TEST_EQ(isum, imin);
+}
+
+void test_empty()
+{
+    BOOST_TEST_EQ(reduce_sum(static_cast<const uint128_t*>(nullptr), 0U), 0U);
+    BOOST_TEST_EQ(reduce_min(static_cast<const uint128_t*>(nullptr), 0U), (std::numeric_limits<uint128_t>::max)());
+    BOOST_TEST_EQ(reduce_max(static_cast<const uint128_t*>(nullptr), 0U), 0U);
+    BOOST_TEST_EQ(reduce_min(static_cast<const int128_t*>(nullptr), 0U), (std::numeric_limits<int128_t>::max)());
+    BOOST_TEST_EQ(reduce_max(static_cast<const int128_t*>(nullptr), 0U), (std::numeric_limits<int128_t>::min)());
+
+    int128_t sum {5};
+    BOOST_TEST(!reduce_sum_checked(&sum, static_cast<const int128_t*>(nullptr), 0U));
+    BOOST_TEST_EQ(sum, 0);
+}
+
+constexpr int128_t constexpr_reduce()
+{
+    const int128_t a[] {int128_t{-3}, int128_t{UINT64_MAX}, int128_t{1}, int128_t{-4}};
+    int128_t sum {};
+    const bool overflow {reduce_sum_checked(&sum, a, 4U)};
+    return overflow ? int128_t{0} : sum + reduce_sum(a, 4U) + reduce_min(a, 4U) * reduce_max(a, 4U);
+}
+
+void test_constexpr()
+{
+    static_assert(constexpr_reduce() == 2 * (int128_t{UINT64_MAX} - 6) - 4 * int128_t{UINT64_MAX}, "Wrong reduction");
+}
+
+int main()
+{
+    test_arrays<uint128_t>();
+    test_arrays<int128_t>();
+    test_extremum_position<uint128_t>();
+    test_extremum_position<int128_t>();
+    test_overflow();
+    test_empty();
+    test_constexpr();
+
+    return boost::report_errors();
+}
@@ -147,6 +147,10 @@ void test_add_sat<boost::int128::int128_t>()
             const auto sat_res {add_sat(near_min,  i)};
             BOOST_TEST(sat_res == min);
         }
+
+        // Both magnitudes are 2^127, so their sum wraps to zero
+        BOOST_TEST(add_sat(min, min) == min);
+        BOOST_TEST(add_sat(min + boost::int128::int128_t{1}, min) == min);
     }
 }
 
@@ -294,6 +298,10 @@ void test_sub_sat<boost::int128::int128_t>()
         const auto min_max_sat_res {sub_sat(min, min)};
         BOOST_TEST(min_max_naive_res == min_max_sat_res);
     }
+
+    // Zero minus min overflows by exactly one
+    BOOST_TEST(sub_sat(boost::int128::int128_t{0}, min) == max);
+    BOOST_TEST(sub_sat(boost::int128::int128_t{-1}, min) == max);
 }
 
 template <typename T>
@@ -0,0 +1,204 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/int128/soa_vector.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace boost::int128;
+
+static constexpr std::size_t N {67U};
+static std::mt19937_64 rng(42);
+
+template <typename T>
+T from_words(const std::uint64_t high, const std::uint64_t low)
+{
+    return static_cast<T>(uint128_t{high, low});
+}
+
+template <typename T>
+std::vector<T> random_values(const std::size_t n)
+{
+    std::vector<T> values(n);
+    for (std::size_t i {}; i < n; ++i)
+    {
+        // Mostly 64-bit values, with their high word 0 or all ones, and some full width ones
+        switch (i % 3U)
+        {
+            case 0U:
+                values[i] = static_cast<T>(uint128_t{rng(), rng()});
+                break;
+            case 1U:
+                values[i] = static_cast<T>(uint128_t{0U, rng()});
+                break;
+            default:
+                values[i] = static_cast<T>(uint128_t{UINT64_MAX, rng()});
+                break;
+        }
+    }
+
+    return values;
+}
+
+template <typename T>
+void test_container()
+{
+    soa_vector<T> empty;
+    BOOST_TEST(empty.empty());
+    BOOST_TEST_EQ(empty.size(), 0U);
+    BOOST_TEST(empty.begin() == empty.end());
+
+    const soa_vector<T> filled(5U, T{3});
+    BOOST_TEST_EQ(filled.size(), 5U);
+    for (const auto value : filled)
+    {
+        BOOST_TEST_EQ(value, T{3});
+    }
+
+    const soa_vector<T> listed {T{1}, T{2}, from_words<T>(UINT64_MAX, 0U)};
+    BOOST_TEST_EQ(listed.size(), 3U);
+    BOOST_TEST_EQ(listed[0], T{1});
+    BOOST_TEST_EQ(listed[2], from_words<T>(UINT64_MAX, 0U));
+    BOOST_TEST_EQ(listed.front(), T{1});
+    BOOST_TEST_EQ(listed.back(), from_words<T>(UINT64_MAX, 0U));
+    BOOST_TEST_EQ(listed.high_data()[2], UINT64_MAX);
+    BOOST_TEST_EQ(listed.low_data()[1], 2U);
+
+    // Round trip through the interleaved layout
+    const auto values {random_values<T>(N)};
+    soa_vector<T> split(values);
+    BOOST_TEST_EQ(split.size(), N);
+    BOOST_TEST(split.to_vector() == values);
+    BOOST_TEST(soa_vector<T>(values.begin(), values.end()) == split);
+    BOOST_TEST(std::equal(split.cbegin(), split.cend(), values.begin()));
+    BOOST_TEST(std::equal(split.crbegin(), split.crend(), values.rbegin()));
+
+    soa_vector<T> copy {split};
+    BOOST_TEST(copy == split);
+    copy[4] = T{0};
+    BOOST_TEST(copy != split);
+
+    split.push_back(T{7});
+    BOOST_TEST_EQ(split.size(), N + 1U);
+    BOOST_TEST_EQ(static_cast<T>(split.back()), T{7});
+    split.pop_back();
+    BOOST_TEST(split.to_vector() == values);
+
+    split.resize(N + 2U, T{9});
+    BOOST_TEST_EQ(static_cast<T>(split[N + 1U]), T{9});
+    split.resize(2U);
+    BOOST_TEST_EQ(split.size(), 2U);
+
+    split.swap(copy);
+    BOOST_TEST_EQ(split.size(), N);
+    BOOST_TEST_EQ(copy.size(), 2U);
+
+    split.clear();
+    BOOST_TEST(split.empty());
+
+    split.reserve(N);
+    BOOST_TEST(split.capacity() >= N);
+}
+
+template <typename T>
+void test_proxies()
+{
+    auto values {random_values<T>(N)};
+    soa_vector<T> split(values);
+
+    // Writes through the proxy update both halves
+    split[1] = from_words<T>(UINT64_MAX, 5U);
+    BOOST_TEST_EQ(split.low_data()[1], 5U);
+    BOOST_TEST_EQ(split.high_data()[1], static_cast<typename soa_vector<T>::high_word_type>(UINT64_MAX));
+
+    split[1] += from_words<T>(0U, UINT64_MAX);
+    BOOST_TEST_EQ(static_cast<T>(split[1]), from_words<T>(UINT64_MAX, 5U) + from_words<T>(0U, UINT64_MAX));
+    split[1] -= from_words<T>(0U, UINT64_MAX);
+    BOOST_TEST_EQ(static_cast<T>(split[1]), from_words<T>(UINT64_MAX, 5U));
+
+    // Assigning one proxy to another copies the value
+    split[0] = split[2];
+    BOOST_TEST_EQ(static_cast<T>(split[0]), values[2]);
+
+    using std::swap;
+    swap(split[2], split[3]);
+    BOOST_TEST_EQ(static_cast<T>(split[2]), values[3]);
+    BOOST_TEST_EQ(static_cast<T>(split[3]), values[2]);
+
+    // Standard algorithms through the iterators
+    values = split.to_vector();
+    std::reverse(split.begin(), split.end());
+    std::reverse(values.begin(), values.end());
+    BOOST_TEST(split.to_vector() == values);
+
+    std::fill(split.begin() + 2, split.begin() + 4, T{11});
+    BOOST_TEST_EQ(static_cast<T>(split[2]), T{11});
+    BOOST_TEST_EQ(static_cast<T>(split[3]), T{11});
+
+    const auto it {std::find(split.cbegin(), split.cend(), T{11})};
+    BOOST_TEST_EQ(it - split.cbegin(), 2);
+    BOOST_TEST_EQ(std::distance(split.begin(), split.end()), static_cast<std::ptrdiff_t>(N));
+
+    auto last {split.end()};
+    --last;
+    BOOST_TEST(last < split.end());
+    BOOST_TEST_EQ(static_cast<T>(*last), static_cast<T>(split.back()));
+    BOOST_TEST_EQ(static_cast<T>(split.begin()[5]), static_cast<T>(split[5]));
+
+    values = split.to_vector();
+    // Summing unsigned so that random int128_t values wrap without signed overflow
+    const auto add = [](const uint128_t sum, const T value) { return sum + static_cast<uint128_t>(value); };
+    BOOST_TEST_EQ(std::accumulate(split.begin(), split.end(), uint128_t{0}, add), std::accumulate(values.begin(), values.end(), uint128_t{0}, add));
+}
+
+template <typename T>
+void test_arithmetic()
+{
+    // Every length up to N covers both the vector loop and the scalar tail
+    for (std::size_t n {}; n <= N; ++n)
+    {
+        const auto a {random_values<T>(n)};
+        const auto b {random_values<T>(n)};
+        const soa_vector<T> split_a(a);
+        const soa_vector<T> split_b(b);
+        std::vector<T> expected(n);
+
+        soa_vector<T> out;
+        add(split_a, split_b, out);
+        add(a.data(), b.data(), expected.data(), n);
+        BOOST_TEST(out.to_vector() == expected);
+
+        sub(split_a, split_b, out);
+        sub(a.data(), b.data(), expected.data(), n);
+        BOOST_TEST(out.to_vector() == expected);
+
+        const auto scalar {from_words<T>(n, UINT64_MAX - n)};
+        add_scalar(split_a, scalar, out);
+        add_scalar(a.data(), scalar, expected.data(), n);
+        BOOST_TEST(out.to_vector() == expected);
+
+        // In place
+        auto in_place {split_a};
+        sub(in_place, split_b, in_place);
+        add(split_b, in_place, in_place);
+        BOOST_TEST(in_place == split_a);
+    }
+}
+
+int main()
+{
+    test_container<uint128_t>();
+    test_container<int128_t>();
+    test_proxies<uint128_t>();
+    test_proxies<int128_t>();
+    test_arithmetic<uint128_t>();
+    test_arithmetic<int128_t>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,226 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/int128/sort.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <limits>
+#include <vector>
+
+using namespace boost::int128;
+
+static std::mt19937_64 rng(42);
+
+// Sizes either side of the insertion sort threshold, and large enough to be partitioned before the in cache passes
+static constexpr std::size_t sizes[] {0U, 1U, 2U, 63U, 64U, 65U, 1000U, 10000U, 150000U};
+
+template <typename T>
+std::vector<T> random_keys(const std::size_t n, const int kind)
+{
+    std::vector<T> keys(n);
+    for (auto& key : keys)
+    {
+        switch (kind)
+        {
+            // Full width keys
+            case 0:
+                key = static_cast<T>(uint128_t{rng(), rng()});
+                break;
+            // Small values, so every pass over the high word is skipped
+            case 1:
+                key = static_cast<T>(uint128_t{0U, rng() >> 32U});
+                break;
+            // Few distinct keys of either sign
+            default:
+                key = static_cast<T>(uint128_t{rng() % 3U == 0U ? UINT64_MAX : 0U, rng() % 5U});
+                break;
+        }
+    }
+
+    return keys;
+}
+
+template <typename T>
+void test_keys()
+{
+    for (const auto n : sizes)
+    {
+        for (int kind {}; kind < 3; ++kind)
+        {
+            auto keys {random_keys<T>(n, kind)};
+            auto expected {keys};
+            std::sort(expected.begin(), expected.end());
+
+            radix_sort(keys.data(), keys.size());
+            BOOST_TEST(keys == expected);
+
+            // Sorting sorted and reversed input
+            radix_sort(keys.data(), keys.size());
+            BOOST_TEST(keys == expected);
+
+            std::reverse(keys.begin(), keys.end());
+            radix_sort(keys.data(), keys.size());
+            BOOST_TEST(keys == expected);
+        }
+    }
+}
+
+template <typename T>
+void test_key_values()
+{
+    for (const auto n : sizes)
+    {
+        for (int kind {}; kind < 3; ++kind)
+        {
+            auto keys {random_keys<T>(n, kind)};
+            std::vector<std::uint32_t> row_ids(n);
+            for (std::size_t i {}; i < n; ++i)
+            {
+                row_ids[i] = static_cast<std::uint32_t>(i);
+            }
+
+            // A stable sort orders equal keys by their original position
+            std::vector<std::uint32_t> expected {row_ids};
+            std::stable_sort(expected.begin(), expected.end(), [&keys](const std::uint32_t lhs, const std::uint32_t rhs)
+            {
+                return keys[lhs] < keys[rhs];
+            });
+
+            const auto original {keys};
+            radix_sort(keys.data(), row_ids.data(), n);
+
+            BOOST_TEST(row_ids == expected);
+            for (std::size_t i {}; i < n; ++i)
+            {
+                BOOST_TEST_EQ(keys[i], original[row_ids[i]]);
+            }
+        }
+    }
+}
+
+// Four threads even on a machine with fewer cores, and sizes which give every thread a chunk
+template <typename T>
+void test_parallel()
+{
+    constexpr unsigned threads {4U};
+
+    for (const auto n : {std::size_t{1000U}, std::size_t{300000U}})
+    {
+        for (int kind {}; kind < 3; ++kind)
+        {
+            auto keys {random_keys<T>(n, kind)};
+            auto expected {keys};
+            std::sort(expected.begin(), expected.end());
+
+            auto parallel_keys {keys};
+            parallel_radix_sort(parallel_keys.data(), n, threads);
+            BOOST_TEST(parallel_keys == expected);
+
+            std::vector<std::uint32_t> row_ids(n);
+            for (std::size_t i {}; i < n; ++i)
+            {
+                row_ids[i] = static_cast<std::uint32_t>(i);
+            }
+
+            auto sorted_keys {keys};
+            auto expected_ids {row_ids};
+            radix_sort(sorted_keys.data(), expected_ids.data(), n);
+            parallel_radix_sort(keys.data(), row_ids.data(), n, threads);
+            BOOST_TEST(keys == expected);
+            BOOST_TEST(row_ids == expected_ids);
+        }
+    }
+}
+
+template <typename T>
+void test_merge()
+{
+    // Runs of different lengths, including empty ones, with many keys shared between runs
+    const std::size_t lengths[] {0U, 70000U, 1U, 130000U, 0U, 99999U};
+    constexpr std::size_t runs {sizeof(lengths) / sizeof(lengths[0])};
+
+    std::size_t bounds[runs + 1U] {};
+    for (std::size_t run {}; run < runs; ++run)
+    {
+        bounds[run + 1U] = bounds[run] + lengths[run];
+    }
+
+    for (int kind {}; kind < 3; ++kind)
+    {
+        auto keys {random_keys<T>(bounds[runs], kind)};
+        for (std::size_t run {}; run < runs; ++run)
+        {
+            std::sort(keys.begin() + static_cast<std::ptrdiff_t>(bounds[run]), keys.begin() + static_cast<std::ptrdiff_t>(bounds[run + 1U]));
+        }
+
+        // Equal keys are expected in the order of their runs
+        auto expected {keys};
+        std::stable_sort(expected.begin(), expected.end());
+
+        for (const unsigned threads : {1U, 3U, 4U})
+        {
+            std::vector<T> merged(keys.size());
+            parallel_merge(keys.data(), bounds, runs, merged.data(), threads);
+            BOOST_TEST(merged == expected);
+        }
+    }
+
+    // Runs starting partway through the array
+    const T keys[] {T{9}, T{1}, T{4}, T{2}, T{3}, T{4}};
+    const std::size_t offset_bounds[] {1U, 3U, 6U};
+    T merged[5] {};
+    parallel_merge(keys, offset_bounds, 2U, merged, 2U);
+    BOOST_TEST(std::is_sorted(merged, merged + 5));
+    BOOST_TEST_EQ(merged[0], T{1});
+    BOOST_TEST_EQ(merged[4], T{4});
+}
+
+void test_limits()
+{
+    constexpr auto imax {(std::numeric_limits<int128_t>::max)()};
+    constexpr auto imin {(std::numeric_limits<int128_t>::min)()};
+
+    std::vector<int128_t> keys(100U);
+    for (std::size_t i {}; i < keys.size(); ++i)
+    {
+        const int128_t values[] {imax, imin, -1, 0, 1, int128_t{INT64_MIN}, int128_t{INT64_MAX}};
+        keys[i] = values[i % 7U];
+    }
+
+    radix_sort(keys.data(), keys.size());
+    BOOST_TEST(std::is_sorted(keys.begin(), keys.end()));
+    BOOST_TEST_EQ(keys.front(), imin);
+    BOOST_TEST_EQ(keys.back(), imax);
+
+    constexpr auto umax {(std::numeric_limits<uint128_t>::max)()};
+
+    std::vector<uint128_t> ukeys(100U, umax);
+    std::vector<std::string> names(100U);
+    ukeys[50] = 0U;
+    names[50] = "zero";
+
+    radix_sort(ukeys.data(), names.data(), ukeys.size());
+    BOOST_TEST_EQ(ukeys.front(), 0U);
+    BOOST_TEST_EQ(names.front(), "zero");
+    BOOST_TEST_EQ(ukeys.back(), umax);
+}
+
+int main()
+{
+    test_keys<uint128_t>();
+    test_keys<int128_t>();
+    test_key_values<uint128_t>();
+    test_key_values<int128_t>();
+    test_parallel<uint128_t>();
+    test_parallel<int128_t>();
+    test_merge<uint128_t>();
+    test_merge<int128_t>();
+    test_limits();
+
+    return boost::report_errors();
+}
@@ -11,6 +11,7 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <string>
 #include <random>
 
 #ifdef __clang__
@@ -148,7 +149,7 @@ void test_error_values()
     std::stringstream in2;
     in2.str("+42");
     in2 >> val2;
-    BOOST_TEST_EQ(val2, 0U);
+    BOOST_TEST_EQ(val2, 42U);
 
     uint128_t val3;
     std::stringstream in3;
@@ -191,6 +192,103 @@ void test_error_values()
     BOOST_TEST_EQ(overflow_val, 0U);
 }
 
+// Field width, fill and adjustment apply to the whole value, and the stream continues after the last digit
+void test_stream_layout()
+{
+    using boost::int128::uint128_t;
+    using boost::int128::int128_t;
+
+    std::stringstream out;
+    out << std::setw(8) << int128_t{-42} << '|'
+        << std::setw(8) << std::left << int128_t{-42} << '|'
+        << std::setw(8) << std::internal << int128_t{-42} << '|'
+        << std::setfill('*') << std::hex << std::setw(8) << uint128_t{255U} << '|'
+        << std::right << std::setw(8) << uint128_t{255U} << '|'
+        << uint128_t{255U} << '|'
+        << std::oct << std::internal << std::setw(8) << int128_t{-8};
+    BOOST_TEST_CSTR_EQ(out.str().c_str(), "     -42|-42     |-     42|0x****ff|****0xff|0xff|0-****10");
+
+    std::stringstream in {"  12 -34\n0x1f 0x-1f ff 7g 8"};
+    uint128_t first {};
+    int128_t second {};
+    in >> first >> second;
+    BOOST_TEST_EQ(first, 12U);
+    BOOST_TEST_EQ(second, -34);
+
+    in >> std::hex >> first >> second;
+    BOOST_TEST_EQ(first, 0x1FU);
+    BOOST_TEST_EQ(second, -0x1F);
+    in >> first;
+    BOOST_TEST_EQ(first, 0xFFU);
+
+    // Reading stops at the first character which is not a digit in the base, and fails when there are none
+    in >> std::oct >> first;
+    BOOST_TEST_EQ(first, 7U);
+    BOOST_TEST_EQ(in.peek(), 'g');
+    BOOST_TEST(in.good());
+    in >> first;
+    BOOST_TEST(in.fail());
+    BOOST_TEST_EQ(first, 7U);
+
+    in.clear();
+    in.ignore();
+    in >> std::dec >> first;
+    BOOST_TEST_EQ(first, 8U);
+    BOOST_TEST(in.eof() && !in.fail());
+
+    std::stringstream overflow {"340282366920938463463374607431768211456 1"};
+    overflow >> first;
+    BOOST_TEST(overflow.fail());
+    BOOST_TEST_EQ(first, 8U);
+
+    // Leading zeros do not count towards the digits, and overlong numbers are consumed whole and fail
+    std::stringstream zeros {std::string(70U, '0').append("12 7 ").append(70U, '0').append(" ").append(70U, '1').append(" 5")};
+    zeros >> first;
+    BOOST_TEST_EQ(first, 12U);
+    zeros >> first;
+    BOOST_TEST_EQ(first, 7U);
+    zeros >> first;
+    BOOST_TEST_EQ(first, 0U);
+    BOOST_TEST(zeros.good());
+    zeros >> first;
+    BOOST_TEST(zeros.fail());
+    BOOST_TEST_EQ(first, 0U);
+    zeros.clear();
+    zeros >> first;
+    BOOST_TEST_EQ(first, 5U);
+
+    // A leading plus sign is skipped like it is for the builtin integers, but a sign alone is not a number
+    std::stringstream plus {"+5 +17 +0x1f +-3 +"};
+    plus >> first >> second;
+    BOOST_TEST_EQ(first, 5U);
+    BOOST_TEST_EQ(second, 17);
+    plus >> std::hex >> first;
+    BOOST_TEST_EQ(first, 0x1FU);
+    plus >> std::dec >> second;
+    BOOST_TEST(plus.fail());
+    BOOST_TEST_EQ(second, 17);
+    plus.clear();
+    plus.ignore(3);
+    plus >> first;
+    BOOST_TEST(plus.fail());
+    BOOST_TEST_EQ(first, 0x1FU);
+
+    // Wide streams
+    std::wstringstream wide;
+    wide << std::setw(42) << (std::numeric_limits<int128_t>::min)() << L' ' << std::hex << std::uppercase << uint128_t{0xABCU};
+    BOOST_TEST(wide.str() == L"  -170141183460469231731687303715884105728 0XABC");
+
+    int128_t wide_value {};
+    wide >> std::dec >> wide_value >> std::hex >> first;
+    BOOST_TEST_EQ(wide_value, (std::numeric_limits<int128_t>::min)());
+    BOOST_TEST_EQ(first, 0xABCU);
+
+    // A wide character whose low byte is a digit is not one
+    std::wstringstream not_digit {std::wstring(1U, static_cast<wchar_t>(0x131))};
+    not_digit >> first;
+    BOOST_TEST(not_digit.fail());
+}
+
 template <typename T>
 void test_round_trip();
 
@@ -298,6 +396,7 @@ int main()
     #endif
 
     test_error_values();
+    test_stream_layout();
 
     return boost::report_errors();
 }
@@ -0,0 +1,195 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Boundaries of the character conversions shared by the streams, literals and string functions
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+// Every power of 10 and its neighbours, which change the number of digits and cross the 19 digit chunks
+void test_decimal_boundaries()
+{
+    using boost::int128::uint128_t;
+    using boost::int128::int128_t;
+
+    char buffer[boost::int128::detail::mini_to_chars_binary_size] {};
+
+    uint128_t power {1U};
+    for (std::size_t zeros {}; zeros <= 38U; ++zeros)
+    {
+        std::string one(zeros + 1U, '0');
+        one.front() = '1';
+        std::string next {one};
+        next.back() = zeros == 0U ? '2' : '1';
+        const std::string previous(zeros == 0U ? 1U : zeros, zeros == 0U ? '0' : '9');
+
+        BOOST_TEST_CSTR_EQ(boost::int128::detail::mini_to_chars(buffer, power, 10, false), one.c_str());
+        BOOST_TEST_CSTR_EQ(boost::int128::detail::mini_to_chars(buffer, power + 1U, 10, false), next.c_str());
+        BOOST_TEST_CSTR_EQ(boost::int128::detail::mini_to_chars(buffer, power - 1U, 10, false), previous.c_str());
+
+        if (zeros < 38U)
+        {
+            BOOST_TEST_CSTR_EQ(boost::int128::detail::mini_to_chars(buffer, -static_cast<int128_t>(power), 10, false), std::string(1U, '-').append(one).c_str());
+        }
+
+        power *= 10U;
+    }
+
+    BOOST_TEST_CSTR_EQ(boost::int128::detail::mini_to_chars(buffer, uint128_t{1U, 0U}, 10, false), "18446744073709551616");
+    BOOST_TEST_CSTR_EQ(boost::int128::detail::mini_to_chars(buffer, uint128_t{UINT64_C(0x8AC7230489E80000), 0U} - 1U, 10, false), "184467440737095516159999999999999999999");
+    BOOST_TEST_CSTR_EQ(boost::int128::detail::mini_to_chars(buffer, uint128_t{UINT64_C(0x8AC7230489E80000), UINT64_MAX}, 10, false), "184467440737095516178446744073709551615");
+}
+
+template <typename T>
+int parse(const std::string& str, T& value)
+{
+    value = T{5};
+    return boost::int128::detail::from_chars(str.data(), str.data() + str.size(), value);
+}
+
+// Digit counts either side of the 8 digit blocks and the 19 digit chunks of the decimal parser, and the overflow limits
+void test_parse_boundaries()
+{
+    using boost::int128::uint128_t;
+    using boost::int128::int128_t;
+
+    uint128_t power {1U};
+    for (std::size_t zeros {}; zeros <= 38U; ++zeros)
+    {
+        std::string nines(zeros == 0U ? 1U : zeros, zeros == 0U ? '0' : '9');
+        std::string one(zeros + 1U, '0');
+        one.front() = '1';
+
+        uint128_t value {};
+        BOOST_TEST_EQ(parse(one, value), -static_cast<int>(one.size()));
+        BOOST_TEST_EQ(value, power);
+        BOOST_TEST_EQ(parse(nines, value), -static_cast<int>(nines.size()));
+        BOOST_TEST_EQ(value, power - 1U);
+
+        // Leading zeros do not count towards the digits
+        const std::string padded {std::string(45U, '0').append(one).append("x")};
+        BOOST_TEST_EQ(parse(padded, value), -static_cast<int>(padded.size() - 1U));
+        BOOST_TEST_EQ(value, power);
+
+        if (zeros < 38U)
+        {
+            int128_t signed_value {};
+            BOOST_TEST_EQ(parse(std::string(1U, '-').append(nines), signed_value), -static_cast<int>(nines.size() + 1U));
+            BOOST_TEST_EQ(signed_value, -static_cast<int128_t>(power - 1U));
+        }
+
+        power *= 10U;
+    }
+
+    // A non-digit inside an 8 digit block ends the number
+    uint128_t value {};
+    BOOST_TEST_EQ(parse(std::string("1234567890123x567890123456789"), value), -13);
+    BOOST_TEST_EQ(value, UINT64_C(1234567890123));
+    BOOST_TEST_EQ(parse(std::string("12345678901234567890123456789012345678x"), value), -38);
+    BOOST_TEST_EQ(value, (uint128_t{UINT64_C(669260594276348691), UINT64_C(14143994781733811022)}));
+
+    BOOST_TEST_EQ(parse(std::string("340282366920938463463374607431768211455"), value), -39);
+    BOOST_TEST_EQ(value, (std::numeric_limits<uint128_t>::max)());
+    BOOST_TEST_EQ(parse(std::string("340282366920938463463374607431768211456"), value), EDOM);
+    BOOST_TEST_EQ(parse(std::string("600000000000000000000000000000000000000"), value), EDOM);
+    BOOST_TEST_EQ(parse(std::string("1000000000000000000000000000000000000000"), value), EDOM);
+    BOOST_TEST_EQ(boost::int128::detail::from_chars("ffffffffffffffffffffffffffffffff", "ffffffffffffffffffffffffffffffff" + 32, value, 16), -32);
+    BOOST_TEST_EQ(value, (std::numeric_limits<uint128_t>::max)());
+    BOOST_TEST_EQ(boost::int128::detail::from_chars("100000000000000000000000000000000", "100000000000000000000000000000000" + 33, value, 16), EDOM);
+
+    int128_t signed_value {};
+    BOOST_TEST_EQ(parse(std::string("170141183460469231731687303715884105727"), signed_value), -39);
+    BOOST_TEST_EQ(signed_value, (std::numeric_limits<int128_t>::max)());
+    BOOST_TEST_EQ(parse(std::string("170141183460469231731687303715884105728"), signed_value), EDOM);
+    BOOST_TEST_EQ(parse(std::string("-170141183460469231731687303715884105728"), signed_value), -40);
+    BOOST_TEST_EQ(signed_value, (std::numeric_limits<int128_t>::min)());
+    BOOST_TEST_EQ(parse(std::string("-170141183460469231731687303715884105729"), signed_value), EDOM);
+    BOOST_TEST_EQ(boost::int128::detail::from_chars("80000000000000000000000000000000", "80000000000000000000000000000000" + 32, signed_value, 16), EDOM);
+
+    using namespace boost::int128::literals;
+    static_assert("340282366920938463463374607431768211455"_u128 == (std::numeric_limits<uint128_t>::max)(), "Wrong parse");
+    static_assert("-170141183460469231731687303715884105728"_i128 == (std::numeric_limits<int128_t>::min)(), "Wrong parse");
+}
+
+// Digit counts either side of the 8 character blocks of bases 2, 8 and 16, and the overflow limits of the parsers
+void test_power_of_2_boundaries()
+{
+    using boost::int128::uint128_t;
+    using boost::int128::int128_t;
+
+    char buffer[boost::int128::detail::mini_to_chars_binary_size] {};
+
+    for (int bits {1}; bits <= 128; ++bits)
+    {
+        const uint128_t value {(std::numeric_limits<uint128_t>::max)() >> (128 - bits)};
+
+        // All ones in binary, then a leading one followed by zeros
+        const std::string ones(static_cast<std::size_t>(bits), '1');
+        BOOST_TEST_CSTR_EQ(boost::int128::detail::mini_to_chars(buffer, value, 2, false), ones.c_str());
+        std::string power(static_cast<std::size_t>(bits), '0');
+        power.front() = '1';
+        BOOST_TEST_CSTR_EQ(boost::int128::detail::mini_to_chars(buffer, uint128_t{1U} << (bits - 1), 2, false), power.c_str());
+
+        const std::string hex {std::string(1U, "137f"[(bits - 1) % 4]).append(static_cast<std::size_t>((bits - 1) / 4), 'f')};
+        BOOST_TEST_CSTR_EQ(boost::int128::detail::mini_to_chars(buffer, value, 16, false), hex.c_str());
+        const std::string octal {std::string(1U, "137"[(bits - 1) % 3]).append(static_cast<std::size_t>((bits - 1) / 3), '7')};
+        BOOST_TEST_CSTR_EQ(boost::int128::detail::mini_to_chars(buffer, value, 8, false), octal.c_str());
+
+        uint128_t parsed {};
+        BOOST_TEST_EQ(boost::int128::detail::from_chars(ones.data(), ones.data() + ones.size(), parsed, 2), -bits);
+        BOOST_TEST_EQ(parsed, value);
+        BOOST_TEST_EQ(boost::int128::detail::from_chars(power.data(), power.data() + power.size(), parsed, 2), -bits);
+        BOOST_TEST_EQ(parsed, uint128_t{1U} << (bits - 1));
+        BOOST_TEST_EQ(boost::int128::detail::from_chars(hex.data(), hex.data() + hex.size(), parsed, 16), -static_cast<int>(hex.size()));
+        BOOST_TEST_EQ(parsed, value);
+        BOOST_TEST_EQ(boost::int128::detail::from_chars(octal.data(), octal.data() + octal.size(), parsed, 8), -static_cast<int>(octal.size()));
+        BOOST_TEST_EQ(parsed, value);
+    }
+
+    BOOST_TEST_CSTR_EQ(boost::int128::detail::mini_to_chars(buffer, uint128_t{UINT64_C(0xABCDEF0123456789), UINT64_C(0xFEDCBA9876543210)}, 16, true), "ABCDEF0123456789FEDCBA9876543210");
+    BOOST_TEST_CSTR_EQ(boost::int128::detail::mini_to_chars(buffer, (std::numeric_limits<int128_t>::min)(), 2, false), std::string(1U, '-').append(1U, '1').append(127U, '0').c_str());
+
+    // Mixed case letters, leading zeros, and a character just outside the digits inside an 8 character block
+    uint128_t value {};
+    const std::string mixed {std::string(40U, '0').append("aBcDeF0123456789fEdCbA9876543210")};
+    BOOST_TEST_EQ(boost::int128::detail::from_chars(mixed.data(), mixed.data() + mixed.size(), value, 16), -static_cast<int>(mixed.size()));
+    BOOST_TEST_EQ(value, (uint128_t{UINT64_C(0xABCDEF0123456789), UINT64_C(0xFEDCBA9876543210)}));
+    for (const char* str : {"123g4567", "123G4567", "123@4567", "123`4567", "123/4567", "123:4567"})
+    {
+        BOOST_TEST_EQ(boost::int128::detail::from_chars(str, str + 8, value, 16), -3);
+        BOOST_TEST_EQ(value, 0x123U);
+    }
+    BOOST_TEST_EQ(boost::int128::detail::from_chars("1234567812345678", "1234567812345678" + 16, value, 8), -7);
+    BOOST_TEST_EQ(value, 01234567U);
+    BOOST_TEST_EQ(boost::int128::detail::from_chars("1011012101101101", "1011012101101101" + 16, value, 2), -6);
+    BOOST_TEST_EQ(value, 0x2DU);
+
+    const std::string binary_overflow {std::string(1U, '1').append(128U, '0')};
+    BOOST_TEST_EQ(boost::int128::detail::from_chars(binary_overflow.data(), binary_overflow.data() + binary_overflow.size(), value, 2), EDOM);
+    const std::string octal_max {std::string(1U, '3').append(42U, '7')};
+    BOOST_TEST_EQ(boost::int128::detail::from_chars(octal_max.data(), octal_max.data() + octal_max.size(), value, 8), -43);
+    BOOST_TEST_EQ(value, (std::numeric_limits<uint128_t>::max)());
+    const std::string octal_overflow {std::string(1U, '4').append(42U, '0')};
+    BOOST_TEST_EQ(boost::int128::detail::from_chars(octal_overflow.data(), octal_overflow.data() + octal_overflow.size(), value, 8), EDOM);
+
+    int128_t signed_value {};
+    const std::string signed_min {std::string("-1").append(127U, '0')};
+    BOOST_TEST_EQ(boost::int128::detail::from_chars(signed_min.data(), signed_min.data() + signed_min.size(), signed_value, 2), -129);
+    BOOST_TEST_EQ(signed_value, (std::numeric_limits<int128_t>::min)());
+    BOOST_TEST_EQ(boost::int128::detail::from_chars(signed_min.data() + 1, signed_min.data() + signed_min.size(), signed_value, 2), EDOM);
+}
+
+int main()
+{
+    test_decimal_boundaries();
+    test_parse_boundaries();
+    test_power_of_2_boundaries();
+
+    return boost::report_errors();
+}